@@ -0,0 +1,181 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    multi_path_publisher_benchmark.cpp
+ * @brief   Multiple Path Publisher Latency and CPU Benchmark
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/UniformRandomizer.h"
+#include "navis_ros/rviz/MultiPathPublisher.h"
+
+#include <nav_msgs/msg/path.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Wall and process CPU time of a measured section
+     */
+    struct Timing
+    {
+        double wall {0.0};
+        double cpu {0.0};
+    };
+
+    /**
+     * @brief Random walk candidate paths, one Pose2DArray per path
+     * @param randomizer Uniform randomizer
+     * @param pathCount Number of paths
+     * @param pointCount Number of points per path
+     */
+    std::vector<navis::util::Pose2DArray> makePaths(navis::util::UniformRandomizer &randomizer, std::size_t pathCount, std::size_t pointCount)
+    {
+        std::vector<navis::util::Pose2DArray> paths(pathCount);
+        for(auto &path : paths)
+        {
+            path.resize(pointCount);
+            double heading = randomizer.uniformDouble(-3.14159, 3.14159);
+            for(std::size_t index = 1; index < pointCount; ++index)
+            {
+                heading += randomizer.uniformDouble(-0.1, 0.1);
+                path.x[index] = path.x[index - 1] + 0.05 * std::cos(heading);
+                path.y[index] = path.y[index - 1] + 0.05 * std::sin(heading);
+                path.yaw[index] = heading;
+            }
+        }
+        return paths;
+    }
+
+    /**
+     * @brief Move the tail of a path, as a replanned candidate would
+     * @param randomizer Uniform randomizer
+     * @param path Path to perturb
+     */
+    void perturb(navis::util::UniformRandomizer &randomizer, navis::util::Pose2DArray &path)
+    {
+        const double offset = randomizer.uniformDouble(-0.2, 0.2);
+        for(std::size_t index = path.size() / 2; index < path.size(); ++index)
+        {
+            path.y[index] += offset;
+        }
+    }
+
+    /**
+     * @brief Time a section by wall clock and process CPU clock
+     * @param section Measured function
+     */
+    template <typename Section>
+    Timing measure(Section &&section)
+    {
+        const auto wallStart = std::chrono::steady_clock::now();
+        const std::clock_t cpuStart = std::clock();
+        section();
+        return {std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count(),
+                static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC};
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    rclcpp::init(argc, argv);
+
+    const std::size_t frameCount = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 100;
+    const std::size_t pointCount = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 400;
+    const double changedRatio    = (argc > 3) ? std::strtod(argv[3], nullptr) : 0.1;
+
+    auto node = std::make_shared<rclcpp::Node>("multi_path_publisher_benchmark");
+    auto pathPublisher = node->create_publisher<nav_msgs::msg::Path>("benchmark/naive_paths", rclcpp::QoS(1));
+    navis::util::UniformRandomizer randomizer(7);
+
+    std_msgs::msg::ColorRGBA color;
+    color.g = 0.8f;
+    color.a = 1.0f;
+
+    std::printf("frames %zu, points per path %zu, changed paths per frame %.0f %%\n", frameCount, pointCount, 100.0 * changedRatio);
+    std::printf("subscribe to benchmark/paths and benchmark/naive_paths (e.g. rviz) to include the transport cost\n\n");
+    std::printf("%8s %14s %14s %14s %14s %12s\n", "paths", "naive ms/frame", "naive cpu ms", "multi ms/frame", "multi cpu ms", "points/frame");
+
+    for(std::size_t pathCount = 16; pathCount <= 4096; pathCount *= 4)
+    {
+        std::vector<navis::util::Pose2DArray> paths = makePaths(randomizer, pathCount, pointCount);
+
+        // Naive : one nav_msgs/Path per path per frame
+        nav_msgs::msg::Path message;
+        message.header.frame_id = "map";
+        Timing naive = measure([&]()
+        {
+            for(std::size_t frame = 0; frame < frameCount; ++frame)
+            {
+                for(const auto &path : paths)
+                {
+                    message.poses.resize(path.size());
+                    for(std::size_t index = 0; index < path.size(); ++index)
+                    {
+                        message.poses[index].pose.position.x = path.x[index];
+                        message.poses[index].pose.position.y = path.y[index];
+                    }
+                    pathPublisher->publish(message);
+                }
+            }
+        });
+
+        navis::ros::MultiPathPublisher::Options options;
+        options.maxPaths = pathCount;
+        options.pointBudget = pathCount * pointCount;   // No decimation : both sides send every point, only the transport differs
+        options.maxRate = 0.0;
+        options.isTimerDriven = false;
+        navis::ros::MultiPathPublisher publisher(*node, "benchmark/paths", options);
+
+        for(std::size_t id = 0; id < pathCount; ++id)
+        {
+            publisher.setPath(static_cast<std::uint32_t>(id), paths[id], color);
+        }
+        publisher.publish();
+
+        const std::size_t changedCount = std::max<std::size_t>(1, static_cast<std::size_t>(changedRatio * static_cast<double>(pathCount)));
+        Timing multi = measure([&]()
+        {
+            for(std::size_t frame = 0; frame < frameCount; ++frame)
+            {
+                // The planner hands over every candidate, only the changed ones reach the wire
+                for(std::size_t change = 0; change < changedCount; ++change)
+                {
+                    perturb(randomizer, paths[randomizer.uniformIndex(pathCount)]);
+                }
+                for(std::size_t id = 0; id < pathCount; ++id)
+                {
+                    publisher.setPath(static_cast<std::uint32_t>(id), paths[id], color);
+                }
+                publisher.publish();
+            }
+        });
+
+        const auto statistics = publisher.getStatistics();
+        const double frames = static_cast<double>(frameCount);
+        std::printf("%8zu %14.3f %14.3f %14.3f %14.3f %12.0f\n", pathCount,
+                    1e3 * naive.wall / frames, 1e3 * naive.cpu / frames, 1e3 * multi.wall / frames, 1e3 * multi.cpu / frames,
+                    static_cast<double>(statistics.pointCount) / static_cast<double>(statistics.publishCount));
+    }
+
+    rclcpp::shutdown();
+    return 0;
+}
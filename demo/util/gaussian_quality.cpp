@@ -0,0 +1,132 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    gaussian_quality.cpp
+ * @brief   Gaussian Randomizer Statistical Quality Check
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/GaussianRandomizer.h"
+#include "navis/util/random/GoodnessOfFit.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Moment and Kolmogorov-Smirnov checks against N(mean, stdDev)
+     * @param name Sampler name
+     * @param samples Sample buffer
+     * @param mean Expected mean
+     * @param stdDev Expected standard deviation
+     * @return True when every check passes
+     */
+    bool checkGaussian(const char *name, const std::vector<double> &samples, double mean, double stdDev)
+    {
+        const double count = static_cast<double>(samples.size());
+        auto moments = navis::util::computeMoments(samples.data(), samples.size());
+
+        // Standard errors of the sample moments of a gaussian
+        double meanError     = stdDev / std::sqrt(count);
+        double varianceError = stdDev * stdDev * std::sqrt(2.0 / (count - 1.0));
+        double skewError     = std::sqrt(6.0 / count);
+        double kurtosisError = std::sqrt(24.0 / count);
+
+        double statistic = navis::util::kolmogorovSmirnovStatistic(samples.data(), samples.size(),
+            [mean, stdDev](double x) { return navis::util::normalCdf((x - mean) / stdDev); });
+        double pValue = navis::util::kolmogorovSmirnovPValue(statistic, samples.size());
+
+        bool passed = std::fabs(moments.mean - mean) < 5.0 * meanError
+                   && std::fabs(moments.variance - stdDev * stdDev) < 5.0 * varianceError
+                   && std::fabs(moments.skewness) < 5.0 * skewError
+                   && std::fabs(moments.excessKurtosis) < 5.0 * kurtosisError
+                   && pValue > 1e-4;
+
+        std::printf("%-22s mean %+.5f  var %.5f  skew %+.5f  kurt %+.5f  KS D %.6f p %.4f  %s\n",
+                    name, moments.mean, moments.variance, moments.skewness, moments.excessKurtosis,
+                    statistic, pValue, passed ? "PASS" : "FAIL");
+        return passed;
+    }
+
+    /**
+     * @brief Nanoseconds per sample of a sampling function
+     */
+    double measure(const std::function<void()> &function, std::size_t samples)
+    {
+        auto start = std::chrono::steady_clock::now();
+        function();
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / static_cast<double>(samples);
+    }
+
+    /**
+     * @brief Parse a positive decimal count argument
+     * @param argument Command line argument
+     * @param count Parsed count
+     * @return False when the argument is not a positive number
+     */
+    bool parseCount(const char *argument, std::size_t &count)
+    {
+        char *end = nullptr;
+        if(argument[0] < '0' || argument[0] > '9')
+        {
+            return false;
+        }
+        count = std::strtoull(argument, &end, 10);
+        return *end == '\0' && count > 0;
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t size = 1000000;
+    if(argc > 2 || (argc > 1 && !parseCount(argv[1], size)))
+    {
+        std::fprintf(stderr, "usage : %s [samples]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    const double mean = 1.5, stdDev = 0.25;
+
+    navis::util::GaussianRandomizer randomizer(1234);
+    std::vector<double> samples(size);
+    bool passed = true;
+
+    double reference = measure([&]() { for(auto &sample : samples) sample = randomizer.gaussianDouble(mean, stdDev); }, size);
+    passed &= checkGaussian("gaussianDouble", samples, mean, stdDev);
+
+    double scalar = measure([&]() { for(auto &sample : samples) sample = randomizer.fastGaussianDouble(mean, stdDev); }, size);
+    passed &= checkGaussian("fastGaussianDouble", samples, mean, stdDev);
+
+    double block = measure([&]() { randomizer.fillGaussianDouble(samples.data(), samples.size(), mean, stdDev); }, size);
+    passed &= checkGaussian("fillGaussianDouble", samples, mean, stdDev);
+
+    // Per-lane parameters : standardize every lane back to N(0, 1)
+    std::vector<double> means(size), stdDevs(size);
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        means[index]   = static_cast<double>(index % 7) - 3.0;
+        stdDevs[index] = 0.5 + static_cast<double>(index % 5);
+    }
+    randomizer.fillGaussianDouble(samples.data(), size, means.data(), stdDevs.data());
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        samples[index] = (samples[index] - means[index]) / stdDevs[index];
+    }
+    passed &= checkGaussian("fillGaussianDouble/lane", samples, 0.0, 1.0);
+
+    std::printf("\nns/sample : gaussianDouble %.2f  fastGaussianDouble %.2f  fillGaussianDouble %.2f\n", reference, scalar, block);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
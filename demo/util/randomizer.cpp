@@ -1 +1,585 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    randomizer.cpp
+ * @brief   Synthetic Random Path Load Generator
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
 
+#include "navis/util/math/Angle.h"
+#include "navis/util/math/Pose.h"
+#include "navis/util/random/GaussianRandomizer.h"
+#include "navis/util/random/UniformRandomizer.h"
+
+#ifdef NAVIS_DEMO_WITH_ROS
+#include "navis_ros/rviz/MultiPathPublisher.h"
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Heap allocations made by the process, counted by the replaced operator new
+     */
+    std::atomic<std::uint64_t> g_allocationCount {0};
+
+} // namespace
+
+void *operator new(std::size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if(void *pointer = std::malloc(size ? size : 1))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Load generator options, set by --name=value arguments
+     */
+    struct Options
+    {
+        std::size_t pathCount {256};
+        std::size_t pathLength {400};
+        std::size_t cloudCount {4};
+        std::size_t cloudSize {2000};
+        double rate {20.0};
+        std::size_t frameCount {400};
+        std::size_t warmupCount {20};
+        std::size_t queueDepth {4};
+        std::uint_fast64_t seed {1};
+        bool isPublished {false};
+    };
+
+    /**
+     * @brief One generated frame, the buffers are allocated once and reused through the frame pool
+     */
+    struct Frame
+    {
+        std::vector<navis::util::Pose2DArray> paths;
+        std::vector<navis::util::Pose2DArray> clouds;
+        std::vector<double> noise;
+        Clock::time_point stamp;
+        std::size_t sequence {0};
+    };
+
+    /**
+     * @brief Bounded frame queue between the generator and the consumer
+     *        Holds indices into the frame pool, the free list holds the others
+     */
+    class FrameQueue
+    {
+        // "FrameQueue" members
+        private:
+
+            std::vector<std::size_t> m_ready;
+            std::vector<std::size_t> m_free;
+            std::size_t m_head {0};
+            std::size_t m_size {0};
+            bool m_isClosed {false};
+            std::mutex m_mutex;
+            std::condition_variable m_condition;
+
+        // "FrameQueue" methods
+        public:
+
+            /**
+             * @brief Class constructor
+             * @param capacity Number of frames in the pool
+             */
+            explicit FrameQueue(std::size_t capacity)
+              : m_ready(capacity)
+            {
+                for(std::size_t index = 0; index < capacity; ++index)
+                {
+                    m_free.push_back(index);
+                }
+            }
+
+            /**
+             * @brief Take a free frame without waiting
+             * @param frame Frame index
+             * @return False when every frame is queued or being consumed
+             */
+            bool acquire(std::size_t &frame)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if(m_free.empty())
+                {
+                    return false;
+                }
+                frame = m_free.back();
+                m_free.pop_back();
+                return true;
+            }
+
+            /**
+             * @brief Queue a generated frame
+             * @param frame Frame index
+             */
+            void push(std::size_t frame)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_ready[(m_head + m_size) % m_ready.size()] = frame;
+                    ++m_size;
+                }
+                m_condition.notify_one();
+            }
+
+            /**
+             * @brief Wait for a queued frame
+             * @param frame Frame index
+             * @return False when the queue is closed and empty
+             */
+            bool pop(std::size_t &frame)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_condition.wait(lock, [this]()
+                {
+                    return m_size > 0 || m_isClosed;
+                });
+
+                if(m_size == 0)
+                {
+                    return false;
+                }
+                frame = m_ready[m_head];
+                m_head = (m_head + 1) % m_ready.size();
+                --m_size;
+                return true;
+            }
+
+            /**
+             * @brief Return a consumed frame to the pool
+             * @param frame Frame index
+             */
+            void release(std::size_t frame)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_free.push_back(frame);
+            }
+
+            /**
+             * @brief Wake the consumer after the last frame
+             */
+            void close()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_isClosed = true;
+                }
+                m_condition.notify_all();
+            }
+
+    }; // class FrameQueue
+
+    /**
+     * @brief Random smooth path generator
+     *        The curvature follows a first order Gauss-Markov process, so heading and position are twice integrated noise
+     */
+    class PathGenerator
+    {
+        // "PathGenerator" members
+        private:
+
+            navis::util::UniformRandomizer m_uniform;
+            navis::util::GaussianRandomizer m_gaussian;
+
+        // "PathGenerator" methods
+        public:
+
+            /**
+             * @brief Class constructor
+             * @param seed Generator seed, the same seed gives the same frames
+             */
+            explicit PathGenerator(std::uint_fast64_t seed)
+              : m_uniform(seed)
+              , m_gaussian(seed)
+            {
+                m_gaussian.setStream(1);
+            }
+
+            /**
+             * @brief Fill a path in place
+             * @param path Output path, keeps its size
+             * @param noise Curvature noise scratch buffer (path size elements)
+             */
+            void fillPath(navis::util::Pose2DArray &path, std::vector<double> &noise)
+            {
+                constexpr double step = 0.1;
+                constexpr double correlation = 0.97;
+
+                m_gaussian.fillGaussianDouble(noise.data(), path.size(), 0.0, 0.02);
+
+                double x = m_uniform.uniformDouble(-50.0, 50.0);
+                double y = m_uniform.uniformDouble(-50.0, 50.0);
+                double heading = m_uniform.uniformDouble(-navis::util::PI, navis::util::PI);
+                double curvature = 0.0;
+
+                for(std::size_t index = 0; index < path.size(); ++index)
+                {
+                    path.x[index] = x;
+                    path.y[index] = y;
+                    path.yaw[index] = navis::util::mod2pi(heading);
+
+                    double sine, cosine;
+                    navis::util::fastSinCos(heading, sine, cosine);
+                    curvature = correlation * curvature + noise[index];
+                    heading += curvature * step;
+                    x += step * cosine;
+                    y += step * sine;
+                }
+            }
+
+            /**
+             * @brief Fill a pose cloud in place, gaussian positions around a random center with uniform headings
+             * @param cloud Output poses, keeps its size
+             */
+            void fillCloud(navis::util::Pose2DArray &cloud)
+            {
+                const double centerX = m_uniform.uniformDouble(-50.0, 50.0);
+                const double centerY = m_uniform.uniformDouble(-50.0, 50.0);
+                const double spread  = m_uniform.uniformDouble(0.5, 3.0);
+
+                m_gaussian.fillGaussianDouble(cloud.x.data(), cloud.size(), centerX, spread);
+                m_gaussian.fillGaussianDouble(cloud.y.data(), cloud.size(), centerY, spread);
+                m_uniform.fillUniformDouble(cloud.yaw.data(), cloud.size(), -navis::util::PI, navis::util::PI);
+            }
+
+    }; // class PathGenerator
+
+    /**
+     * @brief In-process consumer work, reads every point so the frames are really touched
+     * @param frame Consumed frame
+     */
+    double consumeInProcess(const Frame &frame)
+    {
+        double checksum = 0.0;
+        for(const auto &path : frame.paths)
+        {
+            for(std::size_t index = 0; index < path.size(); ++index)
+            {
+                checksum += path.x[index] - path.y[index];
+            }
+        }
+        for(const auto &cloud : frame.clouds)
+        {
+            for(std::size_t index = 0; index < cloud.size(); ++index)
+            {
+                checksum += cloud.yaw[index];
+            }
+        }
+        return checksum;
+    }
+
+    /**
+     * @brief Parse a --name=value argument
+     * @param argument Command line argument
+     * @param name Option name with the leading dashes
+     * @param value Option value
+     * @return False when the argument is another option
+     */
+    bool parseOption(const char *argument, const char *name, std::string &value)
+    {
+        const std::size_t length = std::strlen(name);
+        if(std::strncmp(argument, name, length) != 0 || argument[length] != '=')
+        {
+            return false;
+        }
+        value = argument + length + 1;
+        return true;
+    }
+
+    /**
+     * @brief Parse a decimal count option value
+     * @param value Option value
+     * @param minimum Smallest accepted value
+     * @param count Parsed count, unchanged on failure
+     * @return False when the value is not a decimal number, out of range or below the minimum
+     */
+    template <typename Integer>
+    bool parseCount(const std::string &value, Integer minimum, Integer &count)
+    {
+        if(value.empty() || value[0] < '0' || value[0] > '9')
+        {
+            return false;
+        }
+
+        char *end = nullptr;
+        errno = 0;
+        const unsigned long long parsed = std::strtoull(value.c_str(), &end, 10);
+        if(*end != '\0' || errno == ERANGE || parsed > std::numeric_limits<Integer>::max() || parsed < minimum)
+        {
+            return false;
+        }
+        count = static_cast<Integer>(parsed);
+        return true;
+    }
+
+    /**
+     * @brief Parse a rate option value
+     * @param value Option value
+     * @param rate Parsed rate [Hz], unchanged on failure
+     * @return False when the value is not a finite non-negative number
+     */
+    bool parseRate(const std::string &value, double &rate)
+    {
+        char *end = nullptr;
+        const double parsed = std::strtod(value.c_str(), &end);
+        if(value.empty() || *end != '\0' || !std::isfinite(parsed) || parsed < 0.0)
+        {
+            return false;
+        }
+        rate = parsed;
+        return true;
+    }
+
+    /**
+     * @brief Parse the command line into options
+     * @param argc Number of arguments
+     * @param argv Arguments
+     * @param options Output options
+     * @return False on an unknown argument or an invalid value
+     */
+    bool parseOptions(int argc, char **argv, Options &options)
+    {
+        for(int index = 1; index < argc; ++index)
+        {
+            std::string value;
+            bool isValid = false;
+            if(parseOption(argv[index], "--paths", value))             isValid = parseCount<std::size_t>(value, 1, options.pathCount);
+            else if(parseOption(argv[index], "--length", value))       isValid = parseCount<std::size_t>(value, 2, options.pathLength);
+            else if(parseOption(argv[index], "--clouds", value))       isValid = parseCount<std::size_t>(value, 0, options.cloudCount);
+            else if(parseOption(argv[index], "--cloud-size", value))   isValid = parseCount<std::size_t>(value, 1, options.cloudSize);
+            else if(parseOption(argv[index], "--rate", value))         isValid = parseRate(value, options.rate);
+            else if(parseOption(argv[index], "--frames", value))       isValid = parseCount<std::size_t>(value, 1, options.frameCount);
+            else if(parseOption(argv[index], "--warmup", value))       isValid = parseCount<std::size_t>(value, 0, options.warmupCount);
+            else if(parseOption(argv[index], "--queue", value))        isValid = parseCount<std::size_t>(value, 1, options.queueDepth);
+            else if(parseOption(argv[index], "--seed", value))         isValid = parseCount<std::uint_fast64_t>(value, 0, options.seed);
+            else if(parseOption(argv[index], "--mode", value) && (value == "inprocess" || value == "publish"))
+            {
+                options.isPublished = (value == "publish");
+                isValid = true;
+            }
+
+            if(!isValid)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Percentile of sorted samples, nearest rank
+     * @param sorted Sorted samples (non-empty)
+     * @param percentile Percentile in [0, 100]
+     */
+    double getPercentile(const std::vector<double> &sorted, double percentile)
+    {
+        const std::size_t rank = static_cast<std::size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    if(!parseOptions(argc, argv, options))
+    {
+        std::fprintf(stderr, "usage : %s [--paths=N] [--length=N (>= 2)] [--clouds=N (>= 0)] [--cloud-size=N] [--rate=HZ (0 : unthrottled)]\n"
+                             "          [--frames=N] [--warmup=N (>= 0)] [--queue=N] [--seed=N] [--mode=inprocess|publish]\n"
+                             "        counts are positive unless noted\n", argv[0]);
+        return 1;
+    }
+
+#ifdef NAVIS_DEMO_WITH_ROS
+    rclcpp::init(argc, argv);
+    auto node = std::make_shared<rclcpp::Node>("navis_load_generator");
+    navis::ros::MultiPathPublisher::Options publisherOptions;
+    publisherOptions.maxPaths = std::max<std::size_t>(1, options.pathCount);
+    publisherOptions.maxRate = 0.0;
+    publisherOptions.isTimerDriven = false;
+    navis::ros::MultiPathPublisher publisher(*node, "load_generator/paths", publisherOptions);
+    std_msgs::msg::ColorRGBA color;
+    color.b = 1.0f;
+    color.a = 1.0f;
+#else
+    if(options.isPublished)
+    {
+        std::fprintf(stderr, "--mode=publish needs the ROS 2 build (navis_ros)\n");
+        return 1;
+    }
+#endif
+
+    // Frame pool : every buffer is allocated here, the measured loop reuses them
+    std::vector<Frame> frames(options.queueDepth + 1);
+    for(auto &frame : frames)
+    {
+        frame.paths.resize(options.pathCount);
+        for(auto &path : frame.paths)
+        {
+            path.resize(options.pathLength);
+        }
+        frame.clouds.resize(options.cloudCount);
+        for(auto &cloud : frame.clouds)
+        {
+            cloud.resize(options.cloudSize);
+        }
+        frame.noise.resize(options.pathLength);
+    }
+
+    FrameQueue queue(frames.size());
+    std::vector<double> latencies;
+    latencies.reserve(options.frameCount);
+    std::size_t droppedCount = 0;
+    double checksum = 0.0;
+
+    std::uint64_t steadyAllocations = 0;
+    Clock::time_point steadyStart;
+
+    std::thread consumer([&]()
+    {
+        std::size_t index;
+        while(queue.pop(index))
+        {
+            const Frame &frame = frames[index];
+#ifdef NAVIS_DEMO_WITH_ROS
+            if(options.isPublished)
+            {
+                for(std::size_t path = 0; path < frame.paths.size(); ++path)
+                {
+                    publisher.setPath(static_cast<std::uint32_t>(path), frame.paths[path], color);
+                }
+                publisher.publish();
+            }
+            else
+#endif
+            {
+                checksum += consumeInProcess(frame);
+            }
+
+            if(frame.sequence >= options.warmupCount)
+            {
+                latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - frame.stamp).count());
+            }
+            queue.release(index);
+        }
+    });
+
+    PathGenerator generator(options.seed);
+    const Clock::duration period = (options.rate > 0.0) ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.rate))
+                                                        : Clock::duration::zero();
+    Clock::time_point tick = Clock::now();
+
+    for(std::size_t sequence = 0; sequence < options.warmupCount + options.frameCount; ++sequence)
+    {
+        if(sequence == options.warmupCount)
+        {
+            steadyAllocations = g_allocationCount.load();
+            steadyStart = Clock::now();
+        }
+
+        if(period > Clock::duration::zero())
+        {
+            tick += period;
+            std::this_thread::sleep_until(tick);
+        }
+
+        std::size_t index;
+        if(!queue.acquire(index))
+        {
+            // The consumer is behind : a paced generator drops the frame, an unthrottled one waits
+            if(period > Clock::duration::zero())
+            {
+                ++droppedCount;
+                continue;
+            }
+            while(!queue.acquire(index))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        Frame &frame = frames[index];
+        frame.sequence = sequence;
+        for(auto &path : frame.paths)
+        {
+            generator.fillPath(path, frame.noise);
+        }
+        for(auto &cloud : frame.clouds)
+        {
+            generator.fillCloud(cloud);
+        }
+
+        // Latency runs from the hand-over to the end of consumption
+        frame.stamp = Clock::now();
+        queue.push(index);
+    }
+
+    queue.close();
+    consumer.join();
+
+    const double elapsed = std::chrono::duration<double>(Clock::now() - steadyStart).count();
+    steadyAllocations = g_allocationCount.load() - steadyAllocations;
+
+    std::sort(latencies.begin(), latencies.end());
+    const double consumed = static_cast<double>(latencies.size());
+    const double pointsPerFrame = static_cast<double>(options.pathCount * options.pathLength + options.cloudCount * options.cloudSize);
+
+    std::printf("mode            : %s\n", options.isPublished ? "publish" : "inprocess");
+    std::printf("frames          : %zu consumed, %zu dropped (target %.1f Hz)\n", latencies.size(), droppedCount, options.rate);
+    std::printf("achieved rate   : %.1f frames/s, %.3g points/s\n", consumed / elapsed, consumed * pointsPerFrame / elapsed);
+    if(!latencies.empty())
+    {
+        std::printf("latency [us]    : hand-over to consumed, p50 %.1f, p90 %.1f, p99 %.1f, max %.1f\n",
+                    getPercentile(latencies, 50.0), getPercentile(latencies, 90.0), getPercentile(latencies, 99.0), latencies.back());
+    }
+    std::printf("allocations     : %llu after warmup (%.2f per frame)\n",
+                static_cast<unsigned long long>(steadyAllocations), consumed > 0.0 ? static_cast<double>(steadyAllocations) / consumed : 0.0);
+    std::printf("checksum        : %.6e\n", checksum);
+
+#ifdef NAVIS_DEMO_WITH_ROS
+    rclcpp::shutdown();
+#endif
+    return 0;
+}
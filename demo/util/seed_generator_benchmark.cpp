@@ -0,0 +1,105 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    seed_generator_benchmark.cpp
+ * @brief   Randomizer Construction Throughput Benchmark
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/UniformRandomizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Construct default seeded randomizers from several threads
+     * @param threadCount Number of worker threads
+     * @param perThread Number of randomizers constructed by each thread
+     * @return Elapsed wall time in seconds
+     */
+    double constructConcurrently(unsigned threadCount, std::size_t perThread)
+    {
+        std::vector<std::thread> workers;
+        std::vector<std::uint_fast64_t> checksums(threadCount, 0);
+
+        auto start = std::chrono::steady_clock::now();
+
+        for(unsigned thread = 0; thread < threadCount; ++thread)
+        {
+            workers.emplace_back([&checksums, thread, perThread]()
+            {
+                for(std::size_t count = 0; count < perThread; ++count)
+                {
+                    navis::util::UniformRandomizer randomizer;
+                    checksums[thread] ^= randomizer.getLocalSeed();
+                }
+            });
+        }
+
+        for(auto &worker : workers)
+        {
+            worker.join();
+        }
+
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    /**
+     * @brief Parse a positive decimal count argument
+     * @param argument Command line argument
+     * @param count Parsed count
+     * @return False when the argument is not a positive number
+     */
+    bool parseCount(const char *argument, std::size_t &count)
+    {
+        char *end = nullptr;
+        if(argument[0] < '0' || argument[0] > '9')
+        {
+            return false;
+        }
+        count = std::strtoull(argument, &end, 10);
+        return *end == '\0' && count > 0;
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::size_t perThread  = 20000;
+    std::size_t maxThreads = 2 * std::max(1U, std::thread::hardware_concurrency());
+    if(argc > 3 || (argc > 1 && !parseCount(argv[1], perThread)) || (argc > 2 && !parseCount(argv[2], maxThreads)))
+    {
+        std::fprintf(stderr, "usage : %s [constructions per thread] [max threads]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::printf("%8s %16s %16s\n", "threads", "constructions/s", "ns/construction");
+
+    for(unsigned threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        double seconds = constructConcurrently(threadCount, perThread);
+        double total   = static_cast<double>(threadCount * perThread);
+
+        std::printf("%8u %16.0f %16.1f\n", threadCount, total / seconds, seconds * 1e9 / total);
+    }
+
+    auto statistics = navis::base::Randomizer::getSeedStatistics();
+    std::printf("\nissued seeds        : %llu\n", static_cast<unsigned long long>(statistics.issuedSeeds));
+    std::printf("contended requests  : %llu\n", static_cast<unsigned long long>(statistics.contendedRequests));
+    std::printf("estimated collisions: %.3f\n", statistics.estimatedCollisions);
+
+    return 0;
+}
@@ -0,0 +1,953 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    util_benchmark.cpp
+ * @brief   Random and Angle Utility Benchmark and Statistical Quality Suite
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/math/Angle.h"
+#include "navis/util/math/BinaryAngle.h"
+#include "navis/util/math/CircularStatistics.h"
+#include "navis/util/random/GaussianRandomizer.h"
+#include "navis/util/random/GoodnessOfFit.h"
+#include "navis/util/random/GridDensitySampler.h"
+#include "navis/util/random/ParallelSampler.h"
+#include "navis/util/random/PoissonDiskSampler.h"
+#include "navis/util/random/UniformRandomizer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /**
+     * @brief Minimum p-value of a passing statistical check, the run is seeded so the outcome is reproducible
+     */
+    constexpr double SIGNIFICANCE = 1e-4;
+
+    /**
+     * @brief Benchmark options, set by --name=value arguments
+     */
+    struct Options
+    {
+        std::size_t sampleCount {2000000};
+        std::size_t checkCount {1000000};
+        std::size_t repetitionCount {3};
+        unsigned maxThreads {2 * std::max(1U, std::thread::hardware_concurrency())};
+        std::uint_fast64_t seed {1234};
+        bool isJson {false};
+    };
+
+    /**
+     * @brief Measured timing
+     */
+    struct Measurement
+    {
+        std::string group;
+        std::string name;
+        double value;
+        std::string unit;
+    };
+
+    /**
+     * @brief Statistical or accuracy check, pValue < 0 when the check has no p-value
+     */
+    struct Check
+    {
+        std::string name;
+        std::string statisticName;
+        double statistic;
+        double pValue;
+        bool passed;
+    };
+
+    /**
+     * @brief Collected results and their text or JSON output
+     */
+    class Report
+    {
+        // "Report" members
+        private:
+
+            std::vector<Measurement> m_measurements;
+            std::vector<Check> m_checks;
+
+        // "Report" methods
+        public:
+
+            void addMeasurement(const std::string &group, const std::string &name, double value, const std::string &unit)
+            {
+                m_measurements.push_back({group, name, value, unit});
+            }
+
+            void addCheck(const std::string &name, const std::string &statisticName, double statistic, double pValue)
+            {
+                m_checks.push_back({name, statisticName, statistic, pValue, pValue > SIGNIFICANCE});
+            }
+
+            void addLimitCheck(const std::string &name, const std::string &statisticName, double statistic, double limit)
+            {
+                m_checks.push_back({name, statisticName, statistic, -1.0, statistic <= limit});
+            }
+
+            void addLowerLimitCheck(const std::string &name, const std::string &statisticName, double statistic, double limit)
+            {
+                m_checks.push_back({name, statisticName, statistic, -1.0, statistic >= limit});
+            }
+
+            bool isPassed() const
+            {
+                return std::all_of(m_checks.begin(), m_checks.end(), [](const Check &check) { return check.passed; });
+            }
+
+            /**
+             * @brief Human readable tables
+             */
+            void printText() const
+            {
+                std::string group;
+                for(const auto &measurement : m_measurements)
+                {
+                    if(measurement.group != group)
+                    {
+                        group = measurement.group;
+                        std::printf("\n[%s]\n", group.c_str());
+                    }
+                    std::printf("  %-40s %14.3f %s\n", measurement.name.c_str(), measurement.value, measurement.unit.c_str());
+                }
+
+                std::printf("\n[quality]\n");
+                for(const auto &check : m_checks)
+                {
+                    if(check.pValue >= 0.0)
+                    {
+                        std::printf("  %-40s %-12s %12.5g  p %-10.4g %s\n", check.name.c_str(), check.statisticName.c_str(), check.statistic,
+                                    check.pValue, check.passed ? "PASS" : "FAIL");
+                    }
+                    else
+                    {
+                        std::printf("  %-40s %-12s %12.5g  %-12s %s\n", check.name.c_str(), check.statisticName.c_str(), check.statistic,
+                                    "", check.passed ? "PASS" : "FAIL");
+                    }
+                }
+                std::printf("\n%s\n", isPassed() ? "all checks passed" : "CHECKS FAILED");
+            }
+
+            /**
+             * @brief One JSON document for regression gating
+             */
+            void printJson() const
+            {
+                std::printf("{\n  \"benchmarks\": [\n");
+                for(std::size_t index = 0; index < m_measurements.size(); ++index)
+                {
+                    const auto &measurement = m_measurements[index];
+                    std::printf("    {\"group\": \"%s\", \"name\": \"%s\", \"value\": %.6g, \"unit\": \"%s\"}%s\n", measurement.group.c_str(),
+                                measurement.name.c_str(), measurement.value, measurement.unit.c_str(), (index + 1 < m_measurements.size()) ? "," : "");
+                }
+                std::printf("  ],\n  \"checks\": [\n");
+                for(std::size_t index = 0; index < m_checks.size(); ++index)
+                {
+                    const auto &check = m_checks[index];
+                    char pValue[32];
+                    std::snprintf(pValue, sizeof(pValue), (check.pValue >= 0.0) ? "%.6g" : "null", check.pValue);
+                    std::printf("    {\"name\": \"%s\", \"statistic\": \"%s\", \"value\": %.6g, \"p_value\": %s, \"passed\": %s}%s\n", check.name.c_str(),
+                                check.statisticName.c_str(), check.statistic, pValue, check.passed ? "true" : "false", (index + 1 < m_checks.size()) ? "," : "");
+                }
+                std::printf("  ],\n  \"passed\": %s\n}\n", isPassed() ? "true" : "false");
+            }
+
+    }; // class Report
+
+    /**
+     * @brief Keeps benchmarked results alive
+     */
+    volatile double g_sink = 0.0;
+
+    /**
+     * @brief Best nanoseconds per call over the repetitions
+     * @param options Benchmark options
+     * @param count Number of calls per repetition
+     * @param function Measured function, called with the call index and returning a value to sink
+     */
+    template <typename Function>
+    double nsPerCall(const Options &options, std::size_t count, Function &&function)
+    {
+        double best = 0.0;
+        for(std::size_t repetition = 0; repetition < options.repetitionCount; ++repetition)
+        {
+            double sum = 0.0;
+            const auto start = std::chrono::steady_clock::now();
+            for(std::size_t index = 0; index < count; ++index)
+            {
+                sum += function(index);
+            }
+            const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            g_sink = g_sink + sum;
+            best = (repetition == 0) ? elapsed : std::min(best, elapsed);
+        }
+        return best / static_cast<double>(count);
+    }
+
+    /**
+     * @brief Two-sided p-value of a standard normal z score
+     */
+    double zPValue(double z)
+    {
+        return 2.0 * (1.0 - navis::util::normalCdf(std::fabs(z)));
+    }
+
+    /**
+     * @brief Sampling throughput of the randomizers
+     */
+    void benchmarkSampling(const Options &options, Report &report)
+    {
+        navis::util::UniformRandomizer uniform(options.seed);
+        navis::util::GaussianRandomizer gaussian(options.seed);
+        const std::size_t count = options.sampleCount;
+        std::vector<double> buffer(count);
+
+        report.addMeasurement("sampling", "uniformDouble", nsPerCall(options, count, [&](std::size_t) { return uniform.uniformDouble(); }), "ns/sample");
+        report.addMeasurement("sampling", "uniformInt", nsPerCall(options, count, [&](std::size_t) { return uniform.uniformInt(0, 99); }), "ns/sample");
+        report.addMeasurement("sampling", "uniformBool", nsPerCall(options, count, [&](std::size_t) { return uniform.uniformBool() ? 1.0 : 0.0; }), "ns/sample");
+        report.addMeasurement("sampling", "gaussianDouble", nsPerCall(options, count, [&](std::size_t) { return gaussian.gaussianDouble(); }), "ns/sample");
+        report.addMeasurement("sampling", "foldedGaussianDouble", nsPerCall(options, count, [&](std::size_t) { return gaussian.foldedGaussianDouble(0.0, 1.0, 2.0); }), "ns/sample");
+
+        report.addMeasurement("sampling", "fillUniformDouble", nsPerCall(options, 1, [&](std::size_t)
+        {
+            uniform.fillUniformDouble(buffer.data(), count);
+            return buffer[count / 2];
+        }) / static_cast<double>(count), "ns/sample");
+        report.addMeasurement("sampling", "fillGaussianDouble", nsPerCall(options, 1, [&](std::size_t)
+        {
+            gaussian.fillGaussianDouble(buffer.data(), count);
+            return buffer[count / 2];
+        }) / static_cast<double>(count), "ns/sample");
+    }
+
+    /**
+     * @brief Scalar and block uniformDouble throughput of one engine, the block speedup depends on the word generation cost
+     * @param options Benchmark options
+     * @param report Report
+     * @param name Engine name
+     */
+    template <typename Engine>
+    void benchmarkEngineFill(const Options &options, Report &report, const std::string &name)
+    {
+        navis::util::BasicUniformRandomizer<Engine> uniform(options.seed);
+        const std::size_t count = options.sampleCount;
+        std::vector<double> buffer(count);
+
+        const double scalar = nsPerCall(options, count, [&](std::size_t) { return uniform.uniformDouble(); });
+        const double block  = nsPerCall(options, 1, [&](std::size_t)
+        {
+            uniform.fillUniformDouble(buffer.data(), count);
+            return buffer[count / 2];
+        }) / static_cast<double>(count);
+
+        report.addMeasurement("engines", name + " uniformDouble", scalar, "ns/sample");
+        report.addMeasurement("engines", name + " fillUniformDouble", block, "ns/sample");
+        report.addMeasurement("engines", name + " fill speedup", scalar / block, "x");
+    }
+
+    /**
+     * @brief Scalar versus block fill throughput per engine
+     */
+    void benchmarkEngines(const Options &options, Report &report)
+    {
+        benchmarkEngineFill<std::mt19937>(options, report, "mt19937");
+        benchmarkEngineFill<std::mt19937_64>(options, report, "mt19937_64");
+        benchmarkEngineFill<navis::engine::Xoshiro256Engine>(options, report, "xoshiro256**");
+        benchmarkEngineFill<navis::engine::Pcg64Engine>(options, report, "pcg64");
+        benchmarkEngineFill<navis::engine::PhiloxEngine>(options, report, "philox");
+        benchmarkEngineFill<navis::engine::PrefetchingEngine>(options, report, "prefetching");
+    }
+
+    /**
+     * @brief Default seeded Randomizer construction under thread contention
+     */
+    void benchmarkConstruction(const Options &options, Report &report)
+    {
+        const std::size_t perThread = std::max<std::size_t>(1, options.sampleCount / 100);
+
+        for(unsigned threadCount = 1; threadCount <= options.maxThreads; threadCount *= 2)
+        {
+            std::vector<std::thread> workers;
+            std::vector<std::uint_fast64_t> checksums(threadCount, 0);
+
+            const auto start = std::chrono::steady_clock::now();
+            for(unsigned thread = 0; thread < threadCount; ++thread)
+            {
+                workers.emplace_back([&checksums, thread, perThread]()
+                {
+                    for(std::size_t count = 0; count < perThread; ++count)
+                    {
+                        navis::util::UniformRandomizer randomizer;
+                        checksums[thread] ^= randomizer.getLocalSeed();
+                    }
+                });
+            }
+            for(auto &worker : workers)
+            {
+                worker.join();
+            }
+            const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+            report.addMeasurement("construction", "UniformRandomizer() x " + std::to_string(threadCount) + " threads",
+                                  elapsed / static_cast<double>(threadCount * perThread), "ns/construction");
+        }
+    }
+
+    /**
+     * @brief ParallelSampler throughput per thread count and bitwise agreement of the results across thread counts
+     */
+    void checkParallelSampler(const Options &options, Report &report)
+    {
+        const std::size_t hardwareThreads = std::max(1U, std::thread::hardware_concurrency());
+        std::vector<std::size_t> threadCounts = {1, 2, hardwareThreads, options.maxThreads};
+        std::sort(threadCounts.begin(), threadCounts.end());
+        threadCounts.erase(std::unique(threadCounts.begin(), threadCounts.end()), threadCounts.end());
+
+        const std::uint64_t count = options.sampleCount;
+        auto quarterCircle = [](navis::util::UniformRandomizer &randomizer, std::uint64_t)
+        {
+            const double x = randomizer.uniformDouble(), y = randomizer.uniformDouble();
+            return (x * x + y * y < 1.0) ? 4.0 : 0.0;
+        };
+        auto squareSum = [](navis::util::GaussianRandomizer &randomizer, std::uint64_t begin, std::uint64_t end)
+        {
+            double buffer[256], sum = 0.0;
+            for(std::uint64_t index = begin; index < end; index += 256)
+            {
+                const std::size_t size = static_cast<std::size_t>(std::min<std::uint64_t>(256, end - index));
+                randomizer.fillGaussianDouble(buffer, size);
+                for(std::size_t sample = 0; sample < size; ++sample)
+                {
+                    sum += buffer[sample] * buffer[sample];
+                }
+            }
+            return sum;
+        };
+        auto add = [](double accumulated, double value) { return accumulated + value; };
+
+        double referenceMean = 0.0, referenceSum = 0.0, mismatch = 0.0;
+        for(std::size_t threadCount : threadCounts)
+        {
+            double best = 0.0, mean = 0.0, sum = 0.0;
+            for(std::size_t repetition = 0; repetition < options.repetitionCount; ++repetition)
+            {
+                navis::util::ParallelSampler<navis::util::UniformRandomizer> uniformSampler(options.seed);
+                navis::util::ParallelSampler<navis::util::GaussianRandomizer> gaussianSampler(options.seed);
+                uniformSampler.setThreadCount(threadCount);
+                gaussianSampler.setThreadCount(threadCount);
+
+                const auto start = std::chrono::steady_clock::now();
+                mean = uniformSampler.mean(count, quarterCircle);
+                const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+                best = (repetition == 0) ? elapsed : std::min(best, elapsed);
+
+                sum = gaussianSampler.reduceChunks(count, 0.0, squareSum, add);
+            }
+            report.addMeasurement("parallel", "ParallelSampler::mean x " + std::to_string(threadCount) + " threads", best / static_cast<double>(count), "ns/sample");
+
+            if(threadCount == threadCounts.front())
+            {
+                referenceMean = mean;
+                referenceSum  = sum;
+            }
+            mismatch += (std::memcmp(&mean, &referenceMean, sizeof(double)) != 0) ? 1.0 : 0.0;
+            mismatch += (std::memcmp(&sum, &referenceSum, sizeof(double)) != 0) ? 1.0 : 0.0;
+        }
+
+        report.addLimitCheck("ParallelSampler thread count mismatches", "count", mismatch, 0.0);
+    }
+
+    /**
+     * @brief Angle.h scalar and batch kernels against the standard library
+     */
+    void benchmarkAngle(const Options &options, Report &report)
+    {
+        navis::util::UniformRandomizer uniform(options.seed);
+        const std::size_t count = options.sampleCount;
+        std::vector<double> angles(count), other(count), first(count), second(count);
+        uniform.fillUniformDouble(angles.data(), count, -100.0, 100.0);
+        uniform.fillUniformDouble(other.data(), count, -100.0, 100.0);
+
+        report.addMeasurement("angle", "std::remainder wrap", nsPerCall(options, count, [&](std::size_t index)
+        {
+            return std::remainder(angles[index], navis::util::TWO_PI);
+        }), "ns/value");
+        report.addMeasurement("angle", "mod2pi", nsPerCall(options, count, [&](std::size_t index) { return navis::util::mod2pi(angles[index]); }), "ns/value");
+        report.addMeasurement("angle", "mod2pi batch", nsPerCall(options, 1, [&](std::size_t)
+        {
+            navis::util::mod2pi(angles.data(), first.data(), count);
+            return first[count / 2];
+        }) / static_cast<double>(count), "ns/value");
+        report.addMeasurement("angle", "angleDiff batch", nsPerCall(options, 1, [&](std::size_t)
+        {
+            navis::util::angleDiff(angles.data(), other.data(), first.data(), count);
+            return first[count / 2];
+        }) / static_cast<double>(count), "ns/value");
+
+        report.addMeasurement("angle", "std::sin + std::cos", nsPerCall(options, count, [&](std::size_t index)
+        {
+            return std::sin(angles[index]) + std::cos(angles[index]);
+        }), "ns/value");
+        report.addMeasurement("angle", "fastSinCos", nsPerCall(options, count, [&](std::size_t index)
+        {
+            double sine, cosine;
+            navis::util::fastSinCos(angles[index], sine, cosine);
+            return sine + cosine;
+        }), "ns/value");
+        report.addMeasurement("angle", "fastSinCos batch", nsPerCall(options, 1, [&](std::size_t)
+        {
+            navis::util::fastSinCos(angles.data(), first.data(), second.data(), count);
+            return first[count / 2];
+        }) / static_cast<double>(count), "ns/value");
+        report.addMeasurement("angle", "BinaryAngle32::sinCos", nsPerCall(options, count, [&](std::size_t index)
+        {
+            double sine, cosine;
+            navis::util::BinaryAngle32::fromRadians(angles[index]).sinCos(sine, cosine);
+            return sine + cosine;
+        }), "ns/value");
+
+        report.addMeasurement("angle", "std::atan2", nsPerCall(options, count, [&](std::size_t index) { return std::atan2(angles[index], other[index]); }), "ns/value");
+        report.addMeasurement("angle", "fastAtan2", nsPerCall(options, count, [&](std::size_t index)
+        {
+            return navis::util::fastAtan2(angles[index], other[index]);
+        }), "ns/value");
+        report.addMeasurement("angle", "fastAtan2 batch", nsPerCall(options, 1, [&](std::size_t)
+        {
+            navis::util::fastAtan2(angles.data(), other.data(), first.data(), count);
+            return first[count / 2];
+        }) / static_cast<double>(count), "ns/value");
+    }
+
+    /**
+     * @brief Chi-square test of integer outcomes against equal probabilities
+     */
+    void checkUniformBins(Report &report, const std::string &name, const std::vector<double> &counts)
+    {
+        const double total = std::accumulate(counts.begin(), counts.end(), 0.0);
+        std::vector<double> expected(counts.size(), total / static_cast<double>(counts.size()));
+        const double statistic = navis::util::chiSquareStatistic(counts.data(), expected.data(), counts.size());
+        report.addCheck(name, "chi2", statistic, navis::util::chiSquarePValue(statistic, counts.size() - 1));
+    }
+
+    /**
+     * @brief Distribution, moment and correlation tests of the randomizers
+     */
+    void checkRandomQuality(const Options &options, Report &report)
+    {
+        const std::size_t count = options.checkCount;
+        const double size = static_cast<double>(count);
+        navis::util::UniformRandomizer uniform(options.seed);
+        navis::util::GaussianRandomizer gaussian(options.seed);
+        std::vector<double> samples(count);
+
+        // uniformDouble : distribution, moments, serial correlation
+        for(auto &sample : samples)
+        {
+            sample = uniform.uniformDouble();
+        }
+        auto uniformCdf = [](double x) { return std::min(1.0, std::max(0.0, x)); };
+        double statistic = navis::util::kolmogorovSmirnovStatistic(samples.data(), count, uniformCdf);
+        report.addCheck("uniformDouble distribution", "KS D", statistic, navis::util::kolmogorovSmirnovPValue(statistic, count));
+
+        std::vector<double> bins(100, 0.0);
+        for(double sample : samples)
+        {
+            bins[std::min<std::size_t>(99, static_cast<std::size_t>(sample * 100.0))] += 1.0;
+        }
+        checkUniformBins(report, "uniformDouble 100 bins", bins);
+
+        auto moments = navis::util::computeMoments(samples.data(), count);
+        const double meanZ = (moments.mean - 0.5) / std::sqrt(1.0 / 12.0 / size);
+        const double varianceZ = (moments.variance - 1.0 / 12.0) / std::sqrt((1.0 / 80.0 - 1.0 / 144.0) / size);
+        report.addCheck("uniformDouble mean", "z", meanZ, zPValue(meanZ));
+        report.addCheck("uniformDouble variance", "z", varianceZ, zPValue(varianceZ));
+
+        const double serialZ = navis::util::correlation(samples.data(), samples.data() + 1, count - 1) * std::sqrt(size - 1.0);
+        report.addCheck("uniformDouble lag-1 correlation", "z", serialZ, zPValue(serialZ));
+
+        uniform.fillUniformDouble(samples.data(), count);
+        statistic = navis::util::kolmogorovSmirnovStatistic(samples.data(), count, uniformCdf);
+        report.addCheck("fillUniformDouble distribution", "KS D", statistic, navis::util::kolmogorovSmirnovPValue(statistic, count));
+
+        // uniformInt and uniformBool : equal outcome frequencies
+        bins.assign(10, 0.0);
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            bins[uniform.uniformInt(0, 9)] += 1.0;
+        }
+        checkUniformBins(report, "uniformInt [0, 9]", bins);
+
+        bins.assign(2, 0.0);
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            bins[uniform.uniformBool() ? 1 : 0] += 1.0;
+        }
+        checkUniformBins(report, "uniformBool", bins);
+
+        // gaussianDouble : distribution and moments against N(0, 1)
+        for(auto &sample : samples)
+        {
+            sample = gaussian.gaussianDouble();
+        }
+        statistic = navis::util::kolmogorovSmirnovStatistic(samples.data(), count, navis::util::normalCdf);
+        report.addCheck("gaussianDouble distribution", "KS D", statistic, navis::util::kolmogorovSmirnovPValue(statistic, count));
+
+        moments = navis::util::computeMoments(samples.data(), count);
+        const double gaussianMeanZ     = moments.mean * std::sqrt(size);
+        const double gaussianVarianceZ = (moments.variance - 1.0) / std::sqrt(2.0 / (size - 1.0));
+        const double skewnessZ         = moments.skewness / std::sqrt(6.0 / size);
+        const double kurtosisZ         = moments.excessKurtosis / std::sqrt(24.0 / size);
+        report.addCheck("gaussianDouble mean", "z", gaussianMeanZ, zPValue(gaussianMeanZ));
+        report.addCheck("gaussianDouble variance", "z", gaussianVarianceZ, zPValue(gaussianVarianceZ));
+        report.addCheck("gaussianDouble skewness", "z", skewnessZ, zPValue(skewnessZ));
+        report.addCheck("gaussianDouble excess kurtosis", "z", kurtosisZ, zPValue(kurtosisZ));
+
+        gaussian.fillGaussianDouble(samples.data(), count);
+        statistic = navis::util::kolmogorovSmirnovStatistic(samples.data(), count, navis::util::normalCdf);
+        report.addCheck("fillGaussianDouble distribution", "KS D", statistic, navis::util::kolmogorovSmirnovPValue(statistic, count));
+
+        // foldedGaussianDouble(0, 1, bias) : 1 - |X - 1| with X ~ N(1, 1 / bias), negative values clamp to 0
+        const double bias = 2.0;
+        auto foldedCdf = [bias](double y) { return (y >= 1.0) ? 1.0 : 2.0 * (1.0 - navis::util::normalCdf((1.0 - y) * bias)); };
+        bins.assign(20, 0.0);
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            bins[std::min<std::size_t>(19, static_cast<std::size_t>(gaussian.foldedGaussianDouble(0.0, 1.0, bias) * 20.0))] += 1.0;
+        }
+        std::vector<double> expected(20);
+        for(std::size_t bin = 0; bin < 20; ++bin)
+        {
+            // The first bin also holds the clamped mass at 0
+            const double lower = (bin == 0) ? 0.0 : foldedCdf(static_cast<double>(bin) / 20.0);
+            expected[bin] = size * (foldedCdf(static_cast<double>(bin + 1) / 20.0) - lower);
+        }
+        statistic = navis::util::chiSquareStatistic(bins.data(), expected.data(), 20);
+        report.addCheck("foldedGaussianDouble 20 bins", "chi2", statistic, navis::util::chiSquarePValue(statistic, 19));
+
+        // Inter-stream correlation : numbered streams of one seed and keyed streams, Bonferroni corrected
+        constexpr std::size_t streamCount = 8;
+        const std::size_t streamLength = std::max<std::size_t>(2, count / streamCount);
+        for(int family = 0; family < 2; ++family)
+        {
+            std::vector<std::vector<double>> streams(streamCount, std::vector<double>(streamLength));
+            for(std::size_t stream = 0; stream < streamCount; ++stream)
+            {
+                navis::util::UniformRandomizer randomizer = (family == 0) ? navis::util::UniformRandomizer(options.seed)
+                                                                          : navis::util::UniformRandomizer(navis::base::StreamKey("benchmark/stream" + std::to_string(stream)));
+                if(family == 0)
+                {
+                    randomizer.setStream(stream);
+                }
+                randomizer.fillUniformDouble(streams[stream].data(), streamLength);
+            }
+
+            double largest = 0.0;
+            for(std::size_t first = 0; first < streamCount; ++first)
+            {
+                for(std::size_t second = first + 1; second < streamCount; ++second)
+                {
+                    const double z = navis::util::correlation(streams[first].data(), streams[second].data(), streamLength) * std::sqrt(static_cast<double>(streamLength));
+                    largest = std::max(largest, std::fabs(z));
+                }
+            }
+            const double pairCount = streamCount * (streamCount - 1) / 2;
+            report.addCheck((family == 0) ? "setStream() cross-correlation" : "StreamKey cross-correlation", "max |z|", largest,
+                            std::min(1.0, pairCount * zPValue(largest)));
+        }
+    }
+
+    /**
+     * @brief Accuracy of the fast angle functions and batch / scalar agreement
+     */
+    void checkAngleAccuracy(const Options &options, Report &report)
+    {
+        navis::util::UniformRandomizer uniform(options.seed);
+        const std::size_t count = std::min<std::size_t>(options.checkCount, 1000000);
+        std::vector<double> angles(count), other(count), sines(count), cosines(count), results(count);
+        uniform.fillUniformDouble(angles.data(), count, -1000.0, 1000.0);
+        uniform.fillUniformDouble(other.data(), count, -1000.0, 1000.0);
+
+        double sinCosError = 0.0, atanError = 0.0, wrapError = 0.0, mismatch = 0.0;
+        navis::util::fastSinCos(angles.data(), sines.data(), cosines.data(), count);
+        navis::util::fastAtan2(angles.data(), other.data(), results.data(), count);
+
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            double sine, cosine;
+            navis::util::fastSinCos(angles[index], sine, cosine);
+            sinCosError = std::max({sinCosError, std::fabs(sine - std::sin(angles[index])), std::fabs(cosine - std::cos(angles[index]))});
+
+            const double angle = navis::util::fastAtan2(angles[index], other[index]);
+            atanError = std::max(atanError, std::fabs(angle - std::atan2(angles[index], other[index])));
+
+            const double wrapped = navis::util::mod2pi(angles[index]);
+            wrapError = std::max(wrapError, std::fabs(std::remainder(wrapped - angles[index], navis::util::TWO_PI)));
+            wrapError = (wrapped >= -navis::util::PI && wrapped < navis::util::PI) ? wrapError : 1.0;
+
+            mismatch += (sine != sines[index] || cosine != cosines[index] || angle != results[index]) ? 1.0 : 0.0;
+        }
+
+        report.addLimitCheck("fastSinCos absolute error", "max", sinCosError, 1e-10);
+        report.addLimitCheck("fastAtan2 absolute error", "max", atanError, 5e-10);
+        report.addLimitCheck("mod2pi wrap error", "max", wrapError, 1e-12);
+        report.addLimitCheck("batch / scalar mismatches", "count", mismatch, 0.0);
+    }
+
+    /**
+     * @brief Sliding window circular mean and variance against a full recomputation over the window
+     *        The headings follow a random walk that keeps crossing +/-PI, so most windows wrap
+     */
+    void checkCircularStatistics(const Options &options, Report &report)
+    {
+        constexpr std::size_t capacity = 64;
+        const std::size_t count = std::min<std::size_t>(options.checkCount, 200000);
+        navis::util::GaussianRandomizer gaussian(options.seed);
+        navis::util::UniformRandomizer uniform(options.seed);
+
+        navis::util::SlidingCircularStatistics sliding(capacity);
+        std::vector<double> headings(count), weights(count);
+        double heading = 3.0, meanError = 0.0, varianceError = 0.0, wrappedCount = 0.0;
+
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            heading = navis::util::mod2pi(heading + gaussian.gaussianDouble(0.0, 0.3));
+            headings[index] = heading;
+            weights[index]  = uniform.uniformDouble(0.5, 2.0);
+            sliding.push(headings[index], weights[index]);
+
+            navis::util::CircularStatistics reference;
+            const std::size_t begin = (index + 1 > capacity) ? index + 1 - capacity : 0;
+            double lowest = navis::util::PI, highest = -navis::util::PI;
+            for(std::size_t sample = begin; sample <= index; ++sample)
+            {
+                reference.push(headings[sample], weights[sample]);
+                lowest  = std::min(lowest, headings[sample]);
+                highest = std::max(highest, headings[sample]);
+            }
+            wrappedCount += (highest - lowest > navis::util::PI) ? 1.0 : 0.0;
+
+            const navis::util::CircularStatistics &statistics = sliding.getStatistics();
+            varianceError = std::max(varianceError, std::fabs(statistics.getVariance() - reference.getVariance()));
+            if(reference.getResultantLength() > 1e-3)
+            {
+                meanError = std::max(meanError, std::fabs(navis::util::angleDiff(statistics.getMean(), reference.getMean())));
+            }
+        }
+
+        report.addLimitCheck("sliding circular mean error", "max", meanError, 1e-9);
+        report.addLimitCheck("sliding circular variance error", "max", varianceError, 1e-9);
+        report.addLimitCheck("windows wrapping across +/-PI", "missing", (wrappedCount > 0.0) ? 0.0 : 1.0, 0.0);
+    }
+
+    /**
+     * @brief Chi-square test of the drawn cell frequencies against the densities
+     * @param report Report
+     * @param name Check name
+     * @param sampler Rebuilt grid sampler
+     * @param densities Dense copy of the grid densities
+     * @param randomizer Uniform randomizer providing the engine
+     * @param count Number of draws, half scalar and half block
+     */
+    void checkCellFrequencies(Report &report, const std::string &name, const navis::util::GridDensitySampler &sampler,
+                              const std::vector<double> &densities, navis::util::UniformRandomizer &randomizer, std::size_t count)
+    {
+        std::vector<double> counts(densities.size(), 0.0);
+        for(std::size_t index = 0; index < count / 2; ++index)
+        {
+            counts[sampler.sampleCell(randomizer.getEngine())] += 1.0;
+        }
+        std::vector<std::size_t> cells(count - count / 2);
+        sampler.fillCells(randomizer.getEngine(), cells.data(), cells.size());
+        for(std::size_t cell : cells)
+        {
+            counts[cell] += 1.0;
+        }
+
+        // Only non-zero cells are binned, a draw in a zero density cell fails the check by itself
+        const double total = std::accumulate(densities.begin(), densities.end(), 0.0);
+        std::vector<double> observed, expected;
+        double misplaced = 0.0;
+        for(std::size_t cell = 0; cell < densities.size(); ++cell)
+        {
+            if(densities[cell] > 0.0)
+            {
+                observed.push_back(counts[cell]);
+                expected.push_back(static_cast<double>(count) * densities[cell] / total);
+            }
+            else
+            {
+                misplaced += counts[cell];
+            }
+        }
+
+        const double statistic = navis::util::chiSquareStatistic(observed.data(), expected.data(), observed.size());
+        report.addCheck(name, "chi2", statistic, (misplaced > 0.0) ? 0.0 : navis::util::chiSquarePValue(statistic, observed.size() - 1));
+    }
+
+    /**
+     * @brief GridDensitySampler cell frequencies after construction and after a window update, 2-D and 3-D
+     *        The grids are not tile multiples and a quarter of the cells is empty
+     */
+    void checkGridDensitySampler(const Options &options, Report &report)
+    {
+        navis::util::UniformRandomizer uniform(options.seed);
+        const std::size_t count = std::max<std::size_t>(options.checkCount, 100000);
+        auto randomDensity = [&uniform]() { return uniform.uniformBool() && uniform.uniformBool() ? 0.0 : uniform.uniformDouble(0.1, 1.0); };
+
+        constexpr std::size_t sizeX = 40, sizeY = 37;
+        navis::util::GridDensitySampler planar(sizeX, sizeY, 0.05, 0.0, 0.0);
+        std::vector<double> densities(sizeX * sizeY);
+        for(auto &density : densities)
+        {
+            density = randomDensity();
+        }
+        planar.setDensities(densities.data());
+        planar.rebuild();
+        checkCellFrequencies(report, "GridDensitySampler 2-D", planar, densities, uniform, count);
+
+        // Window across tile borders : clears some cells, fills others
+        constexpr std::size_t windowX = 9, windowY = 5, width = 20, height = 23;
+        std::vector<double> window(width * height);
+        for(std::size_t y = 0; y < height; ++y)
+        {
+            for(std::size_t x = 0; x < width; ++x)
+            {
+                window[y * width + x] = randomDensity();
+                densities[(windowY + y) * sizeX + windowX + x] = window[y * width + x];
+            }
+        }
+        planar.setWindow(windowX, windowY, 0, width, height, 1, window.data());
+        planar.rebuild();
+        checkCellFrequencies(report, "GridDensitySampler 2-D setWindow", planar, densities, uniform, count);
+
+        constexpr std::size_t edge = 13;
+        navis::util::GridDensitySampler spatial(edge, edge, edge, 0.1, 0.0, 0.0, 0.0);
+        densities.assign(edge * edge * edge, 0.0);
+        for(auto &density : densities)
+        {
+            density = randomDensity();
+        }
+        spatial.setDensities(densities.data());
+        spatial.rebuild();
+        checkCellFrequencies(report, "GridDensitySampler 3-D", spatial, densities, uniform, count);
+    }
+
+    /**
+     * @brief Smallest pairwise distance of a Poisson-disk point set relative to max(r_p, r_q), brute force
+     * @param sampler Generated sampler
+     */
+    template <typename Sampler>
+    double getMinimumSpacingRatio(const Sampler &sampler)
+    {
+        const std::size_t dimension = sampler.getDimension();
+        const std::vector<double> &radii = sampler.getRadii();
+        double ratio = std::numeric_limits<double>::infinity();
+
+        for(std::size_t first = 0; first < sampler.size(); ++first)
+        {
+            for(std::size_t second = first + 1; second < sampler.size(); ++second)
+            {
+                double squaredDistance = 0.0;
+                for(std::size_t axis = 0; axis < dimension; ++axis)
+                {
+                    const double difference = sampler.getCoordinates(axis)[first] - sampler.getCoordinates(axis)[second];
+                    squaredDistance += difference * difference;
+                }
+                const double spacing = std::max(radii[first], radii[second]);
+                ratio = std::min(ratio, squaredDistance / (spacing * spacing));
+            }
+        }
+        return std::sqrt(ratio);
+    }
+
+    /**
+     * @brief PoissonDiskSampler spacing with a variable radius and reproducibility from the seed, 2-D and 3-D
+     */
+    void checkPoissonDiskSampler(const Options &options, Report &report)
+    {
+        navis::util::Bounds2D planarBounds;
+        planarBounds.upperX = 8.0;
+        planarBounds.upperY = 6.0;
+        navis::util::Bounds3D spatialBounds;
+        spatialBounds.upperX = spatialBounds.upperY = spatialBounds.upperZ = 2.5;
+
+        // Radius grows along x from the minimum radius to four times it
+        auto makeRadius = [](double minRadius, double length)
+        {
+            return [minRadius, length](const double *position) { return minRadius * (1.0 + 3.0 * position[0] / length); };
+        };
+
+        for(std::size_t dimension = 2; dimension <= 3; ++dimension)
+        {
+            const double minRadius = (dimension == 2) ? 0.08 : 0.12;
+            const double length    = (dimension == 2) ? planarBounds.upperX : spatialBounds.upperX;
+            const std::string name = "PoissonDiskSampler " + std::to_string(dimension) + "-D";
+
+            auto makeSampler = [&]()
+            {
+                return (dimension == 2) ? navis::util::PoissonDiskSampler<>(planarBounds, minRadius, options.seed)
+                                        : navis::util::PoissonDiskSampler<>(spatialBounds, minRadius, options.seed);
+            };
+            navis::util::PoissonDiskSampler<> sampler = makeSampler(), replay = makeSampler();
+            sampler.setRadiusFunction(makeRadius(minRadius, length), 4.0 * minRadius);
+            replay.setRadiusFunction(makeRadius(minRadius, length), 4.0 * minRadius);
+            sampler.generate();
+            replay.generate();
+
+            double differences = (sampler.size() == replay.size() && sampler.size() > 0) ? 0.0 : 1.0;
+            for(std::size_t axis = 0; axis < dimension && differences == 0.0; ++axis)
+            {
+                differences += (sampler.getCoordinates(axis) == replay.getCoordinates(axis)) ? 0.0 : 1.0;
+            }
+
+            report.addLowerLimitCheck(name + " spacing", "d / max(r)", getMinimumSpacingRatio(sampler), 1.0);
+            report.addLimitCheck(name + " same seed replay", "mismatches", differences, 0.0);
+        }
+    }
+
+    /**
+     * @brief Whether a snapshot taken mid-stream replays the same draws on another randomizer of the engine
+     * @param seed Random seed
+     */
+    template <typename Engine>
+    bool isSnapshotReplayed(std::uint_fast64_t seed)
+    {
+        navis::util::BasicUniformRandomizer<Engine> source(seed), target(seed + 1);
+        source.setStream(3);
+        for(int index = 0; index < 37; ++index)
+        {
+            source.uniformDouble();
+        }
+
+        const std::vector<std::uint8_t> snapshot = source.saveState();
+        if(!target.restoreState(snapshot) || target.getLocalSeed() != seed || target.getStream() != 3)
+        {
+            return false;
+        }
+        for(int index = 0; index < 64; ++index)
+        {
+            if(source.uniformDouble() != target.uniformDouble())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Whether a snapshot of one engine is rejected by a randomizer of another engine and leaves it unchanged
+     * @param seed Random seed
+     */
+    template <typename Engine, typename OtherEngine>
+    bool isSnapshotRejected(std::uint_fast64_t seed)
+    {
+        navis::util::BasicUniformRandomizer<Engine> source(seed);
+        navis::util::BasicUniformRandomizer<OtherEngine> target(seed), reference(seed);
+        return !target.restoreState(source.saveState()) && target.uniformDouble() == reference.uniformDouble();
+    }
+
+    /**
+     * @brief Snapshot round trip of every engine and rejection of snapshots from another engine
+     */
+    template <typename Engine, typename OtherEngine>
+    void checkSnapshot(const Options &options, Report &report, const std::string &name)
+    {
+        const double failures = (isSnapshotReplayed<Engine>(options.seed) ? 0.0 : 1.0) + (isSnapshotRejected<OtherEngine, Engine>(options.seed) ? 0.0 : 1.0);
+        report.addLimitCheck("snapshot round trip " + name, "failures", failures, 0.0);
+    }
+
+    void checkSnapshots(const Options &options, Report &report)
+    {
+        // Each engine must refuse a snapshot of another engine, xoshiro256** and PCG64 share state size and output width
+        checkSnapshot<std::mt19937, std::mt19937_64>(options, report, "mt19937");
+        checkSnapshot<std::mt19937_64, std::mt19937>(options, report, "mt19937_64");
+        checkSnapshot<navis::engine::Xoshiro256Engine, navis::engine::Pcg64Engine>(options, report, "xoshiro256**");
+        checkSnapshot<navis::engine::Pcg64Engine, navis::engine::Xoshiro256Engine>(options, report, "pcg64");
+        checkSnapshot<navis::engine::PhiloxEngine, navis::engine::PrefetchingEngine>(options, report, "philox");
+        checkSnapshot<navis::engine::PrefetchingEngine, navis::engine::PhiloxEngine>(options, report, "prefetching");
+    }
+
+    /**
+     * @brief Parse a --name=value argument
+     * @return False when the argument is another option
+     */
+    bool parseOption(const char *argument, const char *name, std::string &value)
+    {
+        const std::size_t length = std::strlen(name);
+        if(std::strncmp(argument, name, length) != 0 || argument[length] != '=')
+        {
+            return false;
+        }
+        value = argument + length + 1;
+        return true;
+    }
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Options options;
+    for(int index = 1; index < argc; ++index)
+    {
+        std::string value;
+        if(parseOption(argv[index], "--samples", value))          options.sampleCount     = std::max<std::size_t>(100, std::strtoull(value.c_str(), nullptr, 10));
+        else if(parseOption(argv[index], "--check-samples", value)) options.checkCount    = std::max<std::size_t>(100, std::strtoull(value.c_str(), nullptr, 10));
+        else if(parseOption(argv[index], "--repetitions", value)) options.repetitionCount = std::max<std::size_t>(1, std::strtoull(value.c_str(), nullptr, 10));
+        else if(parseOption(argv[index], "--threads", value))     options.maxThreads      = std::max(1UL, std::strtoul(value.c_str(), nullptr, 10));
+        else if(parseOption(argv[index], "--seed", value))        options.seed            = std::strtoull(value.c_str(), nullptr, 10);
+        else if(parseOption(argv[index], "--format", value) && (value == "text" || value == "json"))
+        {
+            options.isJson = (value == "json");
+        }
+        else
+        {
+            std::fprintf(stderr, "usage : %s [--samples=N] [--check-samples=N] [--repetitions=N] [--threads=N] [--seed=N] [--format=text|json]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Report report;
+    benchmarkSampling(options, report);
+    benchmarkEngines(options, report);
+    benchmarkConstruction(options, report);
+    benchmarkAngle(options, report);
+    checkRandomQuality(options, report);
+    checkAngleAccuracy(options, report);
+    checkCircularStatistics(options, report);
+    checkGridDensitySampler(options, report);
+    checkPoissonDiskSampler(options, report);
+    checkSnapshots(options, report);
+    checkParallelSampler(options, report);
+
+    if(options.isJson)
+    {
+        report.printJson();
+    }
+    else
+    {
+        report.printText();
+    }
+    return report.isPassed() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -17,51 +17,260 @@
 #define NAVIS_UTIL_MATH_ANGLE_H_
 
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
 
 namespace navis
 {
     namespace util
     {
+        /**
+         * @brief Angle constants
+         */
+        constexpr double PI          = 3.14159265358979323846;
+        constexpr double TWO_PI      = 2.0 * PI;
+        constexpr double HALF_PI     = 0.5 * PI;
+        constexpr double DEG_TO_RAD  = PI / 180.0;
+        constexpr double RAD_TO_DEG  = 180.0 / PI;
+
+        /**
+         * @brief Argument reduction constants (Cody-Waite)
+         *        The high parts keep 30 significant bits, k * HIGH is exact for |k| < 2^23
+         */
+        constexpr double TWO_PI_HIGH       = 0x1.921fb54p+2;
+        constexpr double TWO_PI_LOW        = 3.968374318722162e-09;
+        constexpr double HALF_PI_HIGH      = 0x1.921fb54p+0;
+        constexpr double HALF_PI_LOW       = 9.920935796805404e-10;
+        constexpr double INVERSE_TWO_PI    = 0.15915494309189535;
+        constexpr double INVERSE_HALF_PI   = 0.6366197723675814;
+        constexpr double TAN_PI_OVER_EIGHT = 0.41421356237309503;
+
+        /**
+         * @brief Fast approximation coefficients, Chebyshev fits in r^2 on the reduced ranges
+         *        sin(r) / r and cos(r) on |r| <= PI / 4, atan(a) / a on |a| <= tan(PI / 8)
+         */
+        inline constexpr double FAST_SIN_COEFFICIENTS[5]  = {0.999999999995673, -0.1666666663159121, 0.008333328782463947, -0.00019839202213813695, 2.717345698545241e-06};
+        inline constexpr double FAST_COS_COEFFICIENTS[5]  = {0.9999999999524894, -0.49999999614857515, 0.0416666166925251, -0.0013886617999425682, 2.437983123082832e-05};
+        inline constexpr double FAST_ATAN_COEFFICIENTS[6] = {0.9999999993712282, -0.33333306893050346, 0.1999818304113814, -0.14239532670370092, 0.10569828810855945, -0.060263052378973093};
+
         /**
          * @brief Convert unit from degree to radians
          * @param degree Degree unit value
          */
-        double deg2rad(const double &degree)
+        constexpr double deg2rad(double degree)
         {
-            return degree / 180.0 * M_PI;
+            return degree * DEG_TO_RAD;
         }
 
         /**
          * @brief Convert unit from radians to degree
          * @param radians Radian unit value
          */
-        double rad2deg(const double &radians)
+        constexpr double rad2deg(double radians)
         {
-            return radians * 180.0 / M_PI;
+            return radians * RAD_TO_DEG;
         }
 
         /**
-         * @brief Wrap around -PI to PI
+         * @brief Wrap around to [-PI, PI)
+         *        Accurate to a few ulp for |radians| < 2^23 * 2 PI, same arithmetic as the batch kernel
          * @param radians Radian unit value
          */
-        double mod2pi(double radians)
+        inline double mod2pi(double radians)
         {
-            radians = fmod(radians, M_2_PI);
+            const double turns = std::nearbyint(radians * INVERSE_TWO_PI);
+            double wrapped = (radians - turns * TWO_PI_HIGH) - turns * TWO_PI_LOW;
 
-            if(radians < -M_PI)
+            if(wrapped >= PI)
+            {
+                wrapped -= TWO_PI;
+            }
+            else if(wrapped < -PI)
             {
-                return radians + M_2_PI;
+                wrapped += TWO_PI;
             }
+            return wrapped;
+        }
+
+        /**
+         * @brief Shortest signed angular difference, to - from wrapped to [-PI, PI)
+         * @param to Target angle [rad]
+         * @param from Source angle [rad]
+         */
+        inline double angleDiff(double to, double from)
+        {
+            return mod2pi(to - from);
+        }
 
-            else if(radians > M_PI)
+        /**
+         * @brief Fast sine and cosine, absolute error below 1e-10 for |radians| < 2^23 * PI / 2
+         *        Quadrant reduction by PI / 2 and degree 9 / 8 polynomials
+         * @param radians Radian unit value
+         * @param sine Sine of the angle
+         * @param cosine Cosine of the angle
+         */
+        inline void fastSinCos(double radians, double &sine, double &cosine)
+        {
+            const double quadrant = std::nearbyint(radians * INVERSE_HALF_PI);
+            const double reduced  = (radians - quadrant * HALF_PI_HIGH) - quadrant * HALF_PI_LOW;
+            const double square   = reduced * reduced;
+
+            const double *s = FAST_SIN_COEFFICIENTS;
+            const double *c = FAST_COS_COEFFICIENTS;
+            const double sinValue = reduced * (s[0] + square * (s[1] + square * (s[2] + square * (s[3] + square * s[4]))));
+            const double cosValue = c[0] + square * (c[1] + square * (c[2] + square * (c[3] + square * c[4])));
+
+            switch(static_cast<long long>(quadrant) & 3)
             {
-                return radians - M_2_PI;
+                case 0:  sine =  sinValue; cosine =  cosValue; break;
+                case 1:  sine =  cosValue; cosine = -sinValue; break;
+                case 2:  sine = -sinValue; cosine = -cosValue; break;
+                default: sine = -cosValue; cosine =  sinValue; break;
             }
+        }
+
+        /**
+         * @brief Fast sine, see fastSinCos()
+         * @param radians Radian unit value
+         */
+        inline double fastSin(double radians)
+        {
+            double sine, cosine;
+            fastSinCos(radians, sine, cosine);
+            return sine;
+        }
+
+        /**
+         * @brief Fast cosine, see fastSinCos()
+         * @param radians Radian unit value
+         */
+        inline double fastCos(double radians)
+        {
+            double sine, cosine;
+            fastSinCos(radians, sine, cosine);
+            return cosine;
+        }
+
+        /**
+         * @brief Fast two-argument arc tangent, absolute error below 5e-10 rad, fastAtan2(0, 0) = 0
+         *        Octant reduction, atan(a) = PI / 4 + atan((a - 1) / (a + 1)) above tan(PI / 8), degree 11 polynomial
+         *        With SSE2 the octant and quadrant selections are bit masks like the batch kernel, random inputs cause no
+         *        branch mispredictions and the result is bitwise identical to the batch kernel as long as the compiler does
+         *        not contract multiply-add pairs into FMA (-ffp-contract=off, set on the navis_util target)
+         * @param y Ordinate
+         * @param x Abscissa
+         */
+        inline double fastAtan2(double y, double x)
+        {
+            const double *a = FAST_ATAN_COEFFICIENTS;
+
+#if defined(__SSE2__)
+            const __m128d signMask = _mm_set_sd(-0.0);
+            const __m128d one      = _mm_set_sd(1.0);
+            const __m128d laneY    = _mm_set_sd(y);
+            const __m128d laneX    = _mm_set_sd(x);
+            const __m128d absY     = _mm_andnot_pd(signMask, laneY);
+            const __m128d absX     = _mm_andnot_pd(signMask, laneX);
+            const __m128d ratio    = _mm_div_sd(_mm_min_sd(absX, absY), _mm_max_sd(_mm_max_sd(absX, absY), _mm_set_sd(0x1p-1022)));
+
+            const __m128d isUpperOctant = _mm_cmpgt_sd(ratio, _mm_set_sd(TAN_PI_OVER_EIGHT));
+            const __m128d upperReduced  = _mm_div_sd(_mm_sub_sd(ratio, one), _mm_add_sd(ratio, one));
+            const double reduced = _mm_cvtsd_f64(_mm_or_pd(_mm_and_pd(isUpperOctant, upperReduced), _mm_andnot_pd(isUpperOctant, ratio)));
+            const double square  = reduced * reduced;
+
+            __m128d angle = _mm_add_sd(_mm_and_pd(isUpperOctant, _mm_set_sd(0.25 * PI)),
+                                       _mm_set_sd(reduced * (a[0] + square * (a[1] + square * (a[2] + square * (a[3] + square * (a[4] + square * a[5])))))));
+
+            // Swap the octant above the diagonal, then mirror the negative x half plane (sign bit broadcast, -0 included)
+            const __m128d isSteep = _mm_cmpgt_sd(absY, absX);
+            angle = _mm_or_pd(_mm_and_pd(isSteep, _mm_sub_sd(_mm_set_sd(HALF_PI), angle)), _mm_andnot_pd(isSteep, angle));
+            const __m128d isNegativeX = _mm_castsi128_pd(_mm_srai_epi32(_mm_shuffle_epi32(_mm_castpd_si128(laneX), 0x55), 31));
+            angle = _mm_or_pd(_mm_and_pd(isNegativeX, _mm_sub_sd(_mm_set_sd(PI), angle)), _mm_andnot_pd(isNegativeX, angle));
 
-            return radians;
+            return _mm_cvtsd_f64(_mm_xor_pd(angle, _mm_and_pd(laneY, signMask)));
+#else
+            const double absX = std::fabs(x);
+            const double absY = std::fabs(y);
+            const double ratio = std::fmin(absX, absY) / std::fmax(std::fmax(absX, absY), 0x1p-1022);
+
+            const bool isUpperOctant = ratio > TAN_PI_OVER_EIGHT;
+            const double reduced = isUpperOctant ? (ratio - 1.0) / (ratio + 1.0) : ratio;
+            const double square  = reduced * reduced;
+
+            double angle = (isUpperOctant ? 0.25 * PI : 0.0) +
+                           reduced * (a[0] + square * (a[1] + square * (a[2] + square * (a[3] + square * (a[4] + square * a[5])))));
+
+            if(absY > absX)
+            {
+                angle = HALF_PI - angle;
+            }
+            if(std::signbit(x))
+            {
+                angle = PI - angle;
+            }
+            return std::copysign(angle, y);
+#endif
         }
 
-        // @TODO More helper functions
+        /**
+         * @brief Batch angle kernels, AVX2, SSE2 or scalar implementation selected at compile time
+         *        Input and output may be the same buffer
+         */
+
+        /**
+         * @brief Convert a buffer from degree to radians
+         * @param degree Degree unit values
+         * @param radians Output buffer (size elements)
+         * @param size Number of values
+         */
+        void deg2rad(const double *degree, double *radians, std::size_t size);
+
+        /**
+         * @brief Convert a buffer from radians to degree
+         * @param radians Radian unit values
+         * @param degree Output buffer (size elements)
+         * @param size Number of values
+         */
+        void rad2deg(const double *radians, double *degree, std::size_t size);
+
+        /**
+         * @brief Wrap a buffer around to [-PI, PI), e.g. the headings of a trajectory or a lidar scan
+         * @param radians Radian unit values
+         * @param wrapped Output buffer (size elements)
+         * @param size Number of values
+         */
+        void mod2pi(const double *radians, double *wrapped, std::size_t size);
+
+        /**
+         * @brief Shortest signed angular differences, to[i] - from[i] wrapped to [-PI, PI)
+         * @param to Target angles [rad]
+         * @param from Source angles [rad]
+         * @param difference Output buffer (size elements)
+         * @param size Number of values
+         */
+        void angleDiff(const double *to, const double *from, double *difference, std::size_t size);
+
+        /**
+         * @brief Fast sine and cosine of a buffer, see fastSinCos()
+         * @param radians Radian unit values
+         * @param sine Output sine buffer (size elements)
+         * @param cosine Output cosine buffer (size elements)
+         * @param size Number of values
+         */
+        void fastSinCos(const double *radians, double *sine, double *cosine, std::size_t size);
+
+        /**
+         * @brief Fast two-argument arc tangent of a buffer, see fastAtan2()
+         * @param y Ordinates
+         * @param x Abscissas
+         * @param angle Output buffer (size elements)
+         * @param size Number of values
+         */
+        void fastAtan2(const double *y, const double *x, double *angle, std::size_t size);
 
     } // namespace util
 
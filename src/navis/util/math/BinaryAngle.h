@@ -0,0 +1,366 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    BinaryAngle.h
+ * @brief   Fixed-Point Binary Angle Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_MATH_BINARYANGLE_H_
+#define NAVIS_UTIL_MATH_BINARYANGLE_H_
+
+#include "navis/util/math/Angle.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief Number of steps of the quarter-wave sine table (log2)
+         */
+        constexpr int BINARY_ANGLE_TABLE_BITS = 10;
+        constexpr std::size_t BINARY_ANGLE_TABLE_SIZE = std::size_t(1) << BINARY_ANGLE_TABLE_BITS;
+
+        /**
+         * @brief Compile-time sine on [0, PI / 2] by its Taylor series (std::sin is not constexpr)
+         * @param radians Radian unit value in [0, PI / 2]
+         */
+        constexpr double constexprSin(double radians)
+        {
+            const double square = radians * radians;
+            double term = radians;
+            double sum  = radians;
+            for(int order = 3; order < 30; order += 2)
+            {
+                term *= -square / static_cast<double>((order - 1) * order);
+                sum  += term;
+            }
+            return sum;
+        }
+
+        /**
+         * @brief Quarter-wave sine table, entry i is sin(i * PI / 2 / BINARY_ANGLE_TABLE_SIZE)
+         */
+        constexpr std::array<double, BINARY_ANGLE_TABLE_SIZE + 1> makeBinaryAngleSineTable()
+        {
+            std::array<double, BINARY_ANGLE_TABLE_SIZE + 1> table {};
+            for(std::size_t index = 0; index <= BINARY_ANGLE_TABLE_SIZE; ++index)
+            {
+                table[index] = constexprSin(HALF_PI * static_cast<double>(index) / static_cast<double>(BINARY_ANGLE_TABLE_SIZE));
+            }
+            table[BINARY_ANGLE_TABLE_SIZE] = 1.0;
+            return table;
+        }
+
+        inline constexpr std::array<double, BINARY_ANGLE_TABLE_SIZE + 1> BINARY_ANGLE_SINE_TABLE = makeBinaryAngleSineTable();
+
+        /**
+         * @brief   navis::util::BinaryAngle
+         * @details Angle stored as an unsigned integer, 2^N counts make one full turn
+         *          Wraparound is the unsigned integer overflow, so sums and differences need no fmod and
+         *          the signed difference of two angles is always the shortest one.
+         *          sin / cos read a quarter-wave table (1024 steps) and correct the residual angle with
+         *          the addition formula : absolute error below 1e-15.
+         * @tparam  StorageType Unsigned integer of 12 to 32 bits (std::uint16_t, std::uint32_t)
+         */
+        template <typename StorageType>
+        class BinaryAngle
+        {
+            static_assert(std::is_unsigned<StorageType>::value, "Binary angle storage must be an unsigned integer");
+            static_assert(std::numeric_limits<StorageType>::digits >= BINARY_ANGLE_TABLE_BITS + 2, "Binary angle storage is too narrow");
+            static_assert(std::numeric_limits<StorageType>::digits <= 32, "Binary angle storage is too wide");
+
+            public:
+
+                /**
+                 * @brief Number of bits, counts per turn and angle of one count
+                 */
+                static constexpr int BITS = std::numeric_limits<StorageType>::digits;
+                static constexpr double COUNTS_PER_TURN = static_cast<double>(std::uint64_t(1) << (BITS - 1)) * 2.0;
+                static constexpr double RADIANS_PER_COUNT = TWO_PI / COUNTS_PER_TURN;
+                static constexpr double COUNTS_PER_RADIAN = COUNTS_PER_TURN / TWO_PI;
+
+            // "BinaryAngle" members
+            private:
+
+                StorageType m_counts {0};
+
+                /**
+                 * @brief Bit layout of the sine lookup : quadrant, table index, residual counts
+                 */
+                static constexpr int RESIDUAL_BITS = BITS - 2 - BINARY_ANGLE_TABLE_BITS;
+                static constexpr StorageType QUADRANT_MASK = static_cast<StorageType>((std::uint64_t(1) << (BITS - 2)) - 1);
+
+            // "BinaryAngle" methods
+            private:
+
+                /**
+                 * @brief Sine and cosine of the angle within its quadrant, before the quadrant rotation
+                 * @param sine Sine of the angle within the quadrant
+                 * @param cosine Cosine of the angle within the quadrant
+                 */
+                constexpr void quadrantSinCos(double &sine, double &cosine) const
+                {
+                    const StorageType position = m_counts & QUADRANT_MASK;
+                    const std::size_t index = static_cast<std::size_t>(position >> RESIDUAL_BITS);
+                    const double residual = static_cast<double>(position & ((StorageType(1) << RESIDUAL_BITS) - 1)) * RADIANS_PER_COUNT;
+
+                    const double tableSine   = BINARY_ANGLE_SINE_TABLE[index];
+                    const double tableCosine = BINARY_ANGLE_SINE_TABLE[BINARY_ANGLE_TABLE_SIZE - index];
+
+                    // The residual is below PI / 2048, the truncated series are exact to double precision
+                    const double square = residual * residual;
+                    const double residualSine   = residual * (1.0 - square / 6.0);
+                    const double residualCosine = 1.0 - 0.5 * square * (1.0 - square / 12.0);
+
+                    sine   = tableSine * residualCosine + tableCosine * residualSine;
+                    cosine = tableCosine * residualCosine - tableSine * residualSine;
+                }
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param NONE Zero angle
+                 */
+                constexpr BinaryAngle() = default;
+
+                /**
+                 * @brief Construction from raw counts
+                 * @param counts Counts, 2^BITS per turn
+                 */
+                static constexpr BinaryAngle fromCounts(StorageType counts)
+                {
+                    BinaryAngle angle;
+                    angle.m_counts = counts;
+                    return angle;
+                }
+
+                /**
+                 * @brief Construction from radians, rounded to the nearest count and wrapped
+                 * @param radians Radian unit value (|radians| < 2^62 / COUNTS_PER_RADIAN)
+                 */
+                static constexpr BinaryAngle fromRadians(double radians)
+                {
+                    const double counts = radians * COUNTS_PER_RADIAN;
+                    const std::int64_t rounded = static_cast<std::int64_t>(counts + ((counts < 0.0) ? -0.5 : 0.5));
+                    return fromCounts(static_cast<StorageType>(static_cast<std::uint64_t>(rounded)));
+                }
+
+                /**
+                 * @brief Construction from degree
+                 * @param degree Degree unit value
+                 */
+                static constexpr BinaryAngle fromDegrees(double degree)
+                {
+                    return fromRadians(degree * DEG_TO_RAD);
+                }
+
+                /**
+                 * @brief Raw counts getter method
+                 */
+                constexpr StorageType getCounts() const
+                {
+                    return m_counts;
+                }
+
+                /**
+                 * @brief Signed counts getter method, in [-2^(BITS-1), 2^(BITS-1))
+                 */
+                constexpr std::int64_t getSignedCounts() const
+                {
+                    const std::int64_t counts = static_cast<std::int64_t>(m_counts);
+                    return (counts >= (std::int64_t(1) << (BITS - 1))) ? counts - (std::int64_t(1) << (BITS - 1)) * 2 : counts;
+                }
+
+                /**
+                 * @brief Angle in radians, wrapped to [-PI, PI)
+                 */
+                constexpr double toRadians() const
+                {
+                    return static_cast<double>(getSignedCounts()) * RADIANS_PER_COUNT;
+                }
+
+                /**
+                 * @brief Angle in radians, wrapped to [0, 2 PI)
+                 */
+                constexpr double toPositiveRadians() const
+                {
+                    return static_cast<double>(m_counts) * RADIANS_PER_COUNT;
+                }
+
+                /**
+                 * @brief Angle in degree, wrapped to [-180, 180)
+                 */
+                constexpr double toDegrees() const
+                {
+                    return toRadians() * RAD_TO_DEG;
+                }
+
+                /**
+                 * @brief Conversion to another storage width, narrowing rounds to the nearest count
+                 */
+                template <typename OtherType>
+                constexpr BinaryAngle<OtherType> convert() const
+                {
+                    constexpr int otherBits = std::numeric_limits<OtherType>::digits;
+                    if constexpr(otherBits >= BITS)
+                    {
+                        return BinaryAngle<OtherType>::fromCounts(static_cast<OtherType>(static_cast<std::uint64_t>(m_counts) << (otherBits - BITS)));
+                    }
+                    else
+                    {
+                        constexpr int shift = BITS - otherBits;
+                        return BinaryAngle<OtherType>::fromCounts(static_cast<OtherType>((static_cast<std::uint64_t>(m_counts) + (std::uint64_t(1) << (shift - 1))) >> shift));
+                    }
+                }
+
+                /**
+                 * @brief Sine and cosine, see the class description for the accuracy
+                 * @param sine Sine of the angle
+                 * @param cosine Cosine of the angle
+                 */
+                constexpr void sinCos(double &sine, double &cosine) const
+                {
+                    double quadrantSine = 0.0, quadrantCosine = 0.0;
+                    quadrantSinCos(quadrantSine, quadrantCosine);
+
+                    switch(m_counts >> (BITS - 2))
+                    {
+                        case 0:  sine =  quadrantSine;   cosine =  quadrantCosine; break;
+                        case 1:  sine =  quadrantCosine; cosine = -quadrantSine;   break;
+                        case 2:  sine = -quadrantSine;   cosine = -quadrantCosine; break;
+                        default: sine = -quadrantCosine; cosine =  quadrantSine;   break;
+                    }
+                }
+
+                /**
+                 * @brief Sine and cosine methods
+                 */
+                constexpr double sin() const
+                {
+                    double sine = 0.0, cosine = 0.0;
+                    sinCos(sine, cosine);
+                    return sine;
+                }
+
+                constexpr double cos() const
+                {
+                    double sine = 0.0, cosine = 0.0;
+                    sinCos(sine, cosine);
+                    return cosine;
+                }
+
+                /**
+                 * @brief Arithmetic operators, wrap around by unsigned overflow
+                 */
+                constexpr BinaryAngle operator+(BinaryAngle other) const
+                {
+                    return fromCounts(static_cast<StorageType>(m_counts + other.m_counts));
+                }
+
+                constexpr BinaryAngle operator-(BinaryAngle other) const
+                {
+                    return fromCounts(static_cast<StorageType>(m_counts - other.m_counts));
+                }
+
+                constexpr BinaryAngle operator-() const
+                {
+                    return fromCounts(static_cast<StorageType>(0U - m_counts));
+                }
+
+                constexpr BinaryAngle operator*(std::int64_t factor) const
+                {
+                    return fromCounts(static_cast<StorageType>(static_cast<std::uint64_t>(m_counts) * static_cast<std::uint64_t>(factor)));
+                }
+
+                constexpr BinaryAngle &operator+=(BinaryAngle other)
+                {
+                    m_counts = static_cast<StorageType>(m_counts + other.m_counts);
+                    return *this;
+                }
+
+                constexpr BinaryAngle &operator-=(BinaryAngle other)
+                {
+                    m_counts = static_cast<StorageType>(m_counts - other.m_counts);
+                    return *this;
+                }
+
+                /**
+                 * @brief Shortest signed difference to another angle, this - other in [-PI, PI)
+                 * @param other Source angle
+                 */
+                constexpr double diffRadians(BinaryAngle other) const
+                {
+                    return (*this - other).toRadians();
+                }
+
+                /**
+                 * @brief Comparison operators
+                 */
+                constexpr bool operator==(BinaryAngle other) const
+                {
+                    return m_counts == other.m_counts;
+                }
+
+                constexpr bool operator!=(BinaryAngle other) const
+                {
+                    return m_counts != other.m_counts;
+                }
+
+        }; // class BinaryAngle
+
+        /**
+         * @brief Binary angles of 16 bits (resolution 9.6e-5 rad) and 32 bits (resolution 1.5e-9 rad)
+         */
+        using BinaryAngle16 = BinaryAngle<std::uint16_t>;
+        using BinaryAngle32 = BinaryAngle<std::uint32_t>;
+
+        /**
+         * @brief Convert a buffer of radians to binary angles
+         * @param radians Radian unit values
+         * @param angles Output buffer (size elements)
+         * @param size Number of values
+         */
+        template <typename StorageType>
+        void toBinaryAngles(const double *radians, BinaryAngle<StorageType> *angles, std::size_t size)
+        {
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                angles[index] = BinaryAngle<StorageType>::fromRadians(radians[index]);
+            }
+        }
+
+        /**
+         * @brief Convert a buffer of binary angles to radians in [-PI, PI)
+         * @param angles Binary angles
+         * @param radians Output buffer (size elements)
+         * @param size Number of values
+         */
+        template <typename StorageType>
+        void fromBinaryAngles(const BinaryAngle<StorageType> *angles, double *radians, std::size_t size)
+        {
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                radians[index] = angles[index].toRadians();
+            }
+        }
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_MATH_BINARYANGLE_H_
@@ -0,0 +1,260 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    CircularStatistics.h
+ * @brief   Circular Statistics Accumulator Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_MATH_CIRCULARSTATISTICS_H_
+#define NAVIS_UTIL_MATH_CIRCULARSTATISTICS_H_
+
+#include "navis/util/math/Angle.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::CircularStatistics
+         * @details Incremental statistics of weighted headings
+         *          Each sample adds its weighted unit vector (cos, sin) to running sums, so push, pop and every
+         *          statistic are O(1). The trigonometry is fastSinCos() (absolute error below 1e-10), batches use its SIMD kernel.
+         *          An optional histogram splits [-PI, PI) into equal bins of summed weight.
+         */
+        class CircularStatistics
+        {
+            // "CircularStatistics" members
+            private:
+
+                double m_sumCos {0.0};
+                double m_sumSin {0.0};
+                double m_weight {0.0};
+                std::uint64_t m_count {0};
+                std::vector<double> m_histogram;
+
+            // "CircularStatistics" methods
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param histogramBins Number of histogram bins (default : 0, no histogram)
+                 */
+                explicit CircularStatistics(std::size_t histogramBins = 0);
+
+                /**
+                 * @brief Histogram bin of an angle
+                 * @param radians Radian unit value
+                 * @param binCount Number of bins (non-zero)
+                 */
+                static std::size_t getBin(double radians, std::size_t binCount)
+                {
+                    std::size_t bin = static_cast<std::size_t>((mod2pi(radians) + PI) * (static_cast<double>(binCount) / TWO_PI));
+                    return (bin < binCount) ? bin : binCount - 1;
+                }
+
+                /**
+                 * @brief Add a sample
+                 * @param radians Radian unit value
+                 * @param weight Non-negative sample weight (default : 1.0)
+                 */
+                void push(double radians, double weight = 1.0);
+
+                /**
+                 * @brief Remove a sample added before with the same angle and weight
+                 * @param radians Radian unit value
+                 * @param weight Sample weight (default : 1.0)
+                 */
+                void pop(double radians, double weight = 1.0);
+
+                /**
+                 * @brief Add a buffer of samples
+                 * @param radians Radian unit values
+                 * @param weights Sample weights (nullptr : unit weights)
+                 * @param size Number of samples
+                 */
+                void push(const double *radians, const double *weights, std::size_t size);
+
+                /**
+                 * @brief Add the samples of another accumulator with the same histogram bins
+                 * @param other Circular statistics
+                 */
+                void merge(const CircularStatistics &other);
+
+                /**
+                 * @brief Remove every sample, the histogram bins are kept
+                 */
+                void reset();
+
+                /**
+                 * @brief Add or remove precomputed terms, used by navis::util::SlidingCircularStatistics
+                 * @param cosine Weighted cosine
+                 * @param sine Weighted sine
+                 * @param weight Sample weight
+                 * @param bin Histogram bin
+                 */
+                void addTerm(double cosine, double sine, double weight, std::size_t bin);
+                void removeTerm(double cosine, double sine, double weight, std::size_t bin);
+
+                /**
+                 * @brief Number of samples and total weight getter methods
+                 */
+                std::uint64_t getCount() const
+                {
+                    return m_count;
+                }
+
+                double getWeight() const
+                {
+                    return m_weight;
+                }
+
+                /**
+                 * @brief Circular mean in [-PI, PI), 0 when the resultant vanishes
+                 */
+                double getMean() const;
+
+                /**
+                 * @brief Mean resultant length R in [0, 1], 1 when every sample points the same way
+                 */
+                double getResultantLength() const;
+
+                /**
+                 * @brief Circular variance, 1 - R
+                 */
+                double getVariance() const
+                {
+                    return 1.0 - getResultantLength();
+                }
+
+                /**
+                 * @brief Circular standard deviation, sqrt(-2 ln R) [rad] (infinite when R = 0)
+                 */
+                double getStdDev() const;
+
+                /**
+                 * @brief Histogram getter methods, bin i covers [-PI + i * width, -PI + (i + 1) * width)
+                 */
+                const std::vector<double> &getHistogram() const
+                {
+                    return m_histogram;
+                }
+
+                double getBinCenter(std::size_t bin) const
+                {
+                    return -PI + (static_cast<double>(bin) + 0.5) * TWO_PI / static_cast<double>(m_histogram.size());
+                }
+
+        }; // class CircularStatistics
+
+        /**
+         * @brief   navis::util::SlidingCircularStatistics
+         * @details Circular statistics of the last capacity samples
+         *          The terms of the window are kept in a ring, a push into a full window pops the oldest sample in O(1).
+         *          The sums are rebuilt from the ring once per capacity evictions, so the rounding drift
+         *          of long running add / remove sequences stays bounded at amortized O(1) cost.
+         */
+        class SlidingCircularStatistics
+        {
+            // "SlidingCircularStatistics" members
+            private:
+
+                /**
+                 * @brief Window sample terms
+                 */
+                struct Term
+                {
+                    double cosine;
+                    double sine;
+                    double weight;
+                    std::size_t bin;
+                };
+
+                CircularStatistics m_statistics;
+                std::vector<Term> m_ring;
+                std::size_t m_head {0};
+                std::size_t m_size {0};
+                std::size_t m_evictions {0};
+
+            // "SlidingCircularStatistics" methods
+            private:
+
+                /**
+                 * @brief Rebuild the sums from the window terms
+                 */
+                void resynchronize();
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param capacity Window length in samples (non-zero)
+                 * @param histogramBins Number of histogram bins (default : 0, no histogram)
+                 */
+                explicit SlidingCircularStatistics(std::size_t capacity, std::size_t histogramBins = 0);
+
+                /**
+                 * @brief Add a sample, the oldest one leaves a full window
+                 * @param radians Radian unit value
+                 * @param weight Non-negative sample weight (default : 1.0)
+                 */
+                void push(double radians, double weight = 1.0);
+
+                /**
+                 * @brief Add a buffer of samples in order
+                 * @param radians Radian unit values
+                 * @param weights Sample weights (nullptr : unit weights)
+                 * @param size Number of samples
+                 */
+                void push(const double *radians, const double *weights, std::size_t size);
+
+                /**
+                 * @brief Remove the oldest sample
+                 * @return False when the window is empty
+                 */
+                bool pop();
+
+                /**
+                 * @brief Remove every sample
+                 */
+                void reset();
+
+                /**
+                 * @brief Window size and capacity getter methods
+                 */
+                std::size_t size() const
+                {
+                    return m_size;
+                }
+
+                std::size_t getCapacity() const
+                {
+                    return m_ring.size();
+                }
+
+                /**
+                 * @brief Statistics of the window
+                 */
+                const CircularStatistics &getStatistics() const
+                {
+                    return m_statistics;
+                }
+
+        }; // class SlidingCircularStatistics
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_MATH_CIRCULARSTATISTICS_H_
@@ -0,0 +1,171 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    Pose.h
+ * @brief   Orientation and Pose Data Type Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_MATH_POSE_H_
+#define NAVIS_UTIL_MATH_POSE_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief Unit quaternion (Hamilton convention)
+         */
+        struct Quaternion
+        {
+            double w {1.0};
+            double x {0.0};
+            double y {0.0};
+            double z {0.0};
+        };
+
+        /**
+         * @brief Euler angles, intrinsic Z-Y-X (yaw, pitch, roll) convention
+         */
+        struct EulerRPY
+        {
+            double roll {0.0};
+            double pitch {0.0};
+            double yaw {0.0};
+        };
+
+        /**
+         * @brief SE(2) pose
+         */
+        struct Pose2D
+        {
+            double x {0.0};
+            double y {0.0};
+            double yaw {0.0};
+        };
+
+        /**
+         * @brief SE(3) pose
+         */
+        struct Pose3D
+        {
+            double x {0.0};
+            double y {0.0};
+            double z {0.0};
+            Quaternion orientation;
+        };
+
+        /**
+         * @brief Axis aligned position bounds
+         */
+        struct Bounds2D
+        {
+            double lowerX {0.0};
+            double upperX {1.0};
+            double lowerY {0.0};
+            double upperY {1.0};
+        };
+
+        /**
+         * @brief Axis aligned position bounds with height
+         */
+        struct Bounds3D
+        {
+            double lowerX {0.0};
+            double upperX {1.0};
+            double lowerY {0.0};
+            double upperY {1.0};
+            double lowerZ {0.0};
+            double upperZ {1.0};
+        };
+
+        /**
+         * @brief Structure-of-arrays containers for batch generation
+         *        resize() keeps every component array the same length
+         */
+        struct QuaternionArray
+        {
+            std::vector<double> w, x, y, z;
+
+            void resize(std::size_t size)
+            {
+                w.resize(size);
+                x.resize(size);
+                y.resize(size);
+                z.resize(size);
+            }
+
+            std::size_t size() const
+            {
+                return w.size();
+            }
+        };
+
+        struct EulerRPYArray
+        {
+            std::vector<double> roll, pitch, yaw;
+
+            void resize(std::size_t size)
+            {
+                roll.resize(size);
+                pitch.resize(size);
+                yaw.resize(size);
+            }
+
+            std::size_t size() const
+            {
+                return roll.size();
+            }
+        };
+
+        struct Pose2DArray
+        {
+            std::vector<double> x, y, yaw;
+
+            void resize(std::size_t size)
+            {
+                x.resize(size);
+                y.resize(size);
+                yaw.resize(size);
+            }
+
+            std::size_t size() const
+            {
+                return x.size();
+            }
+        };
+
+        struct Pose3DArray
+        {
+            std::vector<double> x, y, z;
+            QuaternionArray orientation;
+
+            void resize(std::size_t size)
+            {
+                x.resize(size);
+                y.resize(size);
+                z.resize(size);
+                orientation.resize(size);
+            }
+
+            std::size_t size() const
+            {
+                return x.size();
+            }
+        };
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_MATH_POSE_H_
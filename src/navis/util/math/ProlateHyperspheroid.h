@@ -0,0 +1,152 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ProlateHyperspheroid.h
+ * @brief   Prolate Hyperspheroid Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_MATH_PROLATEHYPERSPHEROID_H_
+#define NAVIS_UTIL_MATH_PROLATEHYPERSPHEROID_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::ProlateHyperspheroid
+         * @details Set of points whose summed distance to two foci is at most the transverse diameter
+         *          (the informed sampling subset of RRT* style planners, Gammell et al. 2014)
+         *          The unit ball to hyperspheroid transform x = C R b + center is cached :
+         *          C is a Householder reflection mapping the first axis onto the focal axis (fixed by the foci),
+         *          R holds the radii (updated by setTransverseDiameter), so a transform costs O(dimension).
+         */
+        class ProlateHyperspheroid
+        {
+            // "ProlateHyperspheroid" members
+            private:
+
+                std::size_t m_dimension;
+                std::vector<double> m_focus1;
+                std::vector<double> m_focus2;
+                std::vector<double> m_center;
+                std::vector<double> m_radii;
+
+                /**
+                 * @brief Unit Householder vector, empty when the focal axis already is the first axis
+                 */
+                std::vector<double> m_reflection;
+
+                double m_minTransverseDiameter;
+                double m_transverseDiameter;
+
+            // "ProlateHyperspheroid" methods
+            private:
+
+                /**
+                 * @brief Radii update from the current transverse diameter
+                 */
+                void updateRadii();
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param dimension Dimension of the space
+                 * @param focus1 First focus (dimension elements)
+                 * @param focus2 Second focus (dimension elements)
+                 * @param transverseDiameter Transverse diameter, clamped to the focal distance (default : focal distance)
+                 */
+                ProlateHyperspheroid(std::size_t dimension, const double *focus1, const double *focus2, double transverseDiameter = 0.0);
+
+                /**
+                 * @brief Transverse diameter setter method, the rotation stays cached
+                 * @param transverseDiameter Transverse diameter (best solution cost)
+                 * @return False when it is smaller than the focal distance, the previous value is kept
+                 */
+                bool setTransverseDiameter(double transverseDiameter);
+
+                /**
+                 * @brief Dimension getter method
+                 */
+                std::size_t getDimension() const
+                {
+                    return m_dimension;
+                }
+
+                /**
+                 * @brief Focal distance getter method (theoretical minimum cost)
+                 */
+                double getMinTransverseDiameter() const
+                {
+                    return m_minTransverseDiameter;
+                }
+
+                /**
+                 * @brief Transverse diameter getter method
+                 */
+                double getTransverseDiameter() const
+                {
+                    return m_transverseDiameter;
+                }
+
+                /**
+                 * @brief Center getter method
+                 */
+                const std::vector<double> &getCenter() const
+                {
+                    return m_center;
+                }
+
+                /**
+                 * @brief Radii getter method, transverse radius first
+                 */
+                const std::vector<double> &getRadii() const
+                {
+                    return m_radii;
+                }
+
+                /**
+                 * @brief Lebesgue measure of the hyperspheroid
+                 */
+                double getVolume() const;
+
+                /**
+                 * @brief Point containment test
+                 * @param point Point (dimension elements)
+                 */
+                bool isInside(const double *point) const;
+
+                /**
+                 * @brief Map a point of the unit ball into the hyperspheroid
+                 * @param ball Point in the unit ball (dimension elements)
+                 * @param output Transformed point (dimension elements, may alias ball)
+                 */
+                void transform(const double *ball, double *output) const;
+
+                /**
+                 * @brief Map points of the unit ball into the hyperspheroid in place (structure-of-arrays layout)
+                 *        Component d of point i is stored at buffer[d * stride + i]
+                 * @param buffer Point buffer
+                 * @param stride Distance between two components of a point
+                 * @param size Number of points
+                 */
+                void transformBlock(double *buffer, std::size_t stride, std::size_t size) const;
+
+        }; // class ProlateHyperspheroid
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_MATH_PROLATEHYPERSPHEROID_H_
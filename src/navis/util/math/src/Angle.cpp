@@ -0,0 +1,322 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    Angle.cpp
+ * @brief   Angle Helper Functions Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/math/Angle.h"
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief SIMD lane operations
+     *        Every kernel is written once against this interface and follows the scalar functions of Angle.h step by step.
+     *        select() chooses by the sign bit of the mask, comparison masks have it set.
+     */
+#if defined(__AVX2__)
+    struct Lane
+    {
+        using Type = __m256d;
+        static constexpr std::size_t WIDTH = 4;
+
+        static Type load(const double *input)              { return _mm256_loadu_pd(input); }
+        static void store(double *output, Type value)      { _mm256_storeu_pd(output, value); }
+        static Type set(double value)                      { return _mm256_set1_pd(value); }
+        static Type add(Type lhs, Type rhs)                { return _mm256_add_pd(lhs, rhs); }
+        static Type sub(Type lhs, Type rhs)                { return _mm256_sub_pd(lhs, rhs); }
+        static Type mul(Type lhs, Type rhs)                { return _mm256_mul_pd(lhs, rhs); }
+        static Type div(Type lhs, Type rhs)                { return _mm256_div_pd(lhs, rhs); }
+        static Type min(Type lhs, Type rhs)                { return _mm256_min_pd(lhs, rhs); }
+        static Type max(Type lhs, Type rhs)                { return _mm256_max_pd(lhs, rhs); }
+        static Type bitAnd(Type lhs, Type rhs)             { return _mm256_and_pd(lhs, rhs); }
+        static Type bitAndNot(Type lhs, Type rhs)          { return _mm256_andnot_pd(lhs, rhs); }
+        static Type bitXor(Type lhs, Type rhs)             { return _mm256_xor_pd(lhs, rhs); }
+        static Type greaterEqual(Type lhs, Type rhs)       { return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ); }
+        static Type greater(Type lhs, Type rhs)            { return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ); }
+        static Type less(Type lhs, Type rhs)               { return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ); }
+        static Type select(Type mask, Type ifSet, Type ifClear) { return _mm256_blendv_pd(ifClear, ifSet, mask); }
+        static Type round(Type value)                      { return _mm256_round_pd(value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+        /**
+         * @brief Integer bits of a rounded value shifted to the sign bit (value + 1.5 * 2^52 holds the integer in its low bits)
+         */
+        static Type integerBitToSign(Type rounded, int bit)
+        {
+            __m256i bits = _mm256_castpd_si256(_mm256_add_pd(rounded, _mm256_set1_pd(0x1.8p+52)));
+            return _mm256_castsi256_pd(_mm256_slli_epi64(bits, 63 - bit));
+        }
+    };
+#elif defined(__SSE2__)
+    struct Lane
+    {
+        using Type = __m128d;
+        static constexpr std::size_t WIDTH = 2;
+
+        static Type load(const double *input)              { return _mm_loadu_pd(input); }
+        static void store(double *output, Type value)      { _mm_storeu_pd(output, value); }
+        static Type set(double value)                      { return _mm_set1_pd(value); }
+        static Type add(Type lhs, Type rhs)                { return _mm_add_pd(lhs, rhs); }
+        static Type sub(Type lhs, Type rhs)                { return _mm_sub_pd(lhs, rhs); }
+        static Type mul(Type lhs, Type rhs)                { return _mm_mul_pd(lhs, rhs); }
+        static Type div(Type lhs, Type rhs)                { return _mm_div_pd(lhs, rhs); }
+        static Type min(Type lhs, Type rhs)                { return _mm_min_pd(lhs, rhs); }
+        static Type max(Type lhs, Type rhs)                { return _mm_max_pd(lhs, rhs); }
+        static Type bitAnd(Type lhs, Type rhs)             { return _mm_and_pd(lhs, rhs); }
+        static Type bitAndNot(Type lhs, Type rhs)          { return _mm_andnot_pd(lhs, rhs); }
+        static Type bitXor(Type lhs, Type rhs)             { return _mm_xor_pd(lhs, rhs); }
+        static Type greaterEqual(Type lhs, Type rhs)       { return _mm_cmpge_pd(lhs, rhs); }
+        static Type greater(Type lhs, Type rhs)            { return _mm_cmpgt_pd(lhs, rhs); }
+        static Type less(Type lhs, Type rhs)               { return _mm_cmplt_pd(lhs, rhs); }
+
+        static Type select(Type mask, Type ifSet, Type ifClear)
+        {
+            // Spread the sign bit over the lane, SSE2 has no 64-bit arithmetic shift
+            __m128i sign = _mm_srai_epi32(_mm_castpd_si128(mask), 31);
+            Type full = _mm_castsi128_pd(_mm_shuffle_epi32(sign, _MM_SHUFFLE(3, 3, 1, 1)));
+            return _mm_or_pd(_mm_and_pd(full, ifSet), _mm_andnot_pd(full, ifClear));
+        }
+
+        /**
+         * @brief Round to nearest even by the 1.5 * 2^52 shift, exact for |value| < 2^51
+         */
+        static Type round(Type value)
+        {
+            const Type shift = _mm_set1_pd(0x1.8p+52);
+            return _mm_sub_pd(_mm_add_pd(value, shift), shift);
+        }
+
+        static Type integerBitToSign(Type rounded, int bit)
+        {
+            __m128i bits = _mm_castpd_si128(_mm_add_pd(rounded, _mm_set1_pd(0x1.8p+52)));
+            return _mm_castsi128_pd(_mm_slli_epi64(bits, 63 - bit));
+        }
+    };
+#endif
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    /**
+     * @brief Wrap around to [-PI, PI), see navis::util::mod2pi()
+     */
+    inline Lane::Type wrapLane(Lane::Type radians)
+    {
+        const Lane::Type turns = Lane::round(Lane::mul(radians, Lane::set(navis::util::INVERSE_TWO_PI)));
+        Lane::Type wrapped = Lane::sub(Lane::sub(radians, Lane::mul(turns, Lane::set(navis::util::TWO_PI_HIGH))),
+                                       Lane::mul(turns, Lane::set(navis::util::TWO_PI_LOW)));
+
+        const Lane::Type pi = Lane::set(navis::util::PI);
+        const Lane::Type twoPi = Lane::set(navis::util::TWO_PI);
+        wrapped = Lane::select(Lane::greaterEqual(wrapped, pi), Lane::sub(wrapped, twoPi), wrapped);
+        return Lane::select(Lane::less(wrapped, Lane::sub(Lane::set(0.0), pi)), Lane::add(wrapped, twoPi), wrapped);
+    }
+
+    /**
+     * @brief Polynomial evaluation by Horner's scheme, coefficients in increasing degree
+     */
+    template <std::size_t SIZE>
+    inline Lane::Type hornerLane(const double (&coefficients)[SIZE], Lane::Type square)
+    {
+        Lane::Type result = Lane::set(coefficients[SIZE - 1]);
+        for(std::size_t index = SIZE - 1; index > 0; --index)
+        {
+            result = Lane::add(Lane::set(coefficients[index - 1]), Lane::mul(square, result));
+        }
+        return result;
+    }
+#endif
+
+    /**
+     * @brief Element-wise scale of a buffer
+     * @param input Input values
+     * @param output Output buffer (size elements)
+     * @param size Number of values
+     * @param factor Scale factor
+     */
+    void scale(const double *input, double *output, std::size_t size, double factor)
+    {
+        std::size_t index = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+        const Lane::Type laneFactor = Lane::set(factor);
+        for(; index + Lane::WIDTH <= size; index += Lane::WIDTH)
+        {
+            Lane::store(output + index, Lane::mul(Lane::load(input + index), laneFactor));
+        }
+#endif
+
+        for(; index < size; ++index)
+        {
+            output[index] = input[index] * factor;
+        }
+    }
+
+} // namespace
+
+/**
+ * @brief Convert a buffer from degree to radians
+ * @param degree Degree unit values
+ * @param radians Output buffer (size elements)
+ * @param size Number of values
+ */
+void navis::util::deg2rad(const double *degree, double *radians, std::size_t size)
+{
+    scale(degree, radians, size, DEG_TO_RAD);
+}
+
+/**
+ * @brief Convert a buffer from radians to degree
+ * @param radians Radian unit values
+ * @param degree Output buffer (size elements)
+ * @param size Number of values
+ */
+void navis::util::rad2deg(const double *radians, double *degree, std::size_t size)
+{
+    scale(radians, degree, size, RAD_TO_DEG);
+}
+
+/**
+ * @brief Wrap a buffer around to [-PI, PI)
+ * @param radians Radian unit values
+ * @param wrapped Output buffer (size elements)
+ * @param size Number of values
+ */
+void navis::util::mod2pi(const double *radians, double *wrapped, std::size_t size)
+{
+    std::size_t index = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    for(; index + Lane::WIDTH <= size; index += Lane::WIDTH)
+    {
+        Lane::store(wrapped + index, wrapLane(Lane::load(radians + index)));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        wrapped[index] = mod2pi(radians[index]);
+    }
+}
+
+/**
+ * @brief Shortest signed angular differences, to[i] - from[i] wrapped to [-PI, PI)
+ * @param to Target angles [rad]
+ * @param from Source angles [rad]
+ * @param difference Output buffer (size elements)
+ * @param size Number of values
+ */
+void navis::util::angleDiff(const double *to, const double *from, double *difference, std::size_t size)
+{
+    std::size_t index = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    for(; index + Lane::WIDTH <= size; index += Lane::WIDTH)
+    {
+        Lane::store(difference + index, wrapLane(Lane::sub(Lane::load(to + index), Lane::load(from + index))));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        difference[index] = angleDiff(to[index], from[index]);
+    }
+}
+
+/**
+ * @brief Fast sine and cosine of a buffer
+ * @param radians Radian unit values
+ * @param sine Output sine buffer (size elements)
+ * @param cosine Output cosine buffer (size elements)
+ * @param size Number of values
+ */
+void navis::util::fastSinCos(const double *radians, double *sine, double *cosine, std::size_t size)
+{
+    std::size_t index = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    for(; index + Lane::WIDTH <= size; index += Lane::WIDTH)
+    {
+        const Lane::Type angle    = Lane::load(radians + index);
+        const Lane::Type quadrant = Lane::round(Lane::mul(angle, Lane::set(INVERSE_HALF_PI)));
+        const Lane::Type reduced  = Lane::sub(Lane::sub(angle, Lane::mul(quadrant, Lane::set(HALF_PI_HIGH))),
+                                              Lane::mul(quadrant, Lane::set(HALF_PI_LOW)));
+        const Lane::Type square   = Lane::mul(reduced, reduced);
+
+        const Lane::Type sinValue = Lane::mul(reduced, hornerLane(FAST_SIN_COEFFICIENTS, square));
+        const Lane::Type cosValue = hornerLane(FAST_COS_COEFFICIENTS, square);
+
+        // Odd quadrants swap sine and cosine, quadrants 2 and 3 negate the sine, 1 and 2 the cosine
+        const Lane::Type bit0 = Lane::integerBitToSign(quadrant, 0);
+        const Lane::Type bit1 = Lane::integerBitToSign(quadrant, 1);
+        const Lane::Type signMask = Lane::set(-0.0);
+
+        Lane::Type sineResult   = Lane::select(bit0, cosValue, sinValue);
+        Lane::Type cosineResult = Lane::select(bit0, sinValue, cosValue);
+        sineResult   = Lane::bitXor(sineResult, Lane::bitAnd(bit1, signMask));
+        cosineResult = Lane::bitXor(cosineResult, Lane::bitAnd(Lane::bitXor(bit0, bit1), signMask));
+
+        Lane::store(sine + index, sineResult);
+        Lane::store(cosine + index, cosineResult);
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        fastSinCos(radians[index], sine[index], cosine[index]);
+    }
+}
+
+/**
+ * @brief Fast two-argument arc tangent of a buffer
+ * @param y Ordinates
+ * @param x Abscissas
+ * @param angle Output buffer (size elements)
+ * @param size Number of values
+ */
+void navis::util::fastAtan2(const double *y, const double *x, double *angle, std::size_t size)
+{
+    std::size_t index = 0;
+
+#if defined(__AVX2__) || defined(__SSE2__)
+    const Lane::Type signMask = Lane::set(-0.0);
+
+    for(; index + Lane::WIDTH <= size; index += Lane::WIDTH)
+    {
+        const Lane::Type laneY = Lane::load(y + index);
+        const Lane::Type laneX = Lane::load(x + index);
+        const Lane::Type absY  = Lane::bitAndNot(signMask, laneY);
+        const Lane::Type absX  = Lane::bitAndNot(signMask, laneX);
+        const Lane::Type ratio = Lane::div(Lane::min(absX, absY), Lane::max(Lane::max(absX, absY), Lane::set(0x1p-1022)));
+
+        const Lane::Type one = Lane::set(1.0);
+        const Lane::Type isUpperOctant = Lane::greater(ratio, Lane::set(TAN_PI_OVER_EIGHT));
+        const Lane::Type reduced = Lane::select(isUpperOctant, Lane::div(Lane::sub(ratio, one), Lane::add(ratio, one)), ratio);
+        const Lane::Type square  = Lane::mul(reduced, reduced);
+
+        Lane::Type result = Lane::add(Lane::bitAnd(isUpperOctant, Lane::set(0.25 * PI)),
+                                      Lane::mul(reduced, hornerLane(FAST_ATAN_COEFFICIENTS, square)));
+        result = Lane::select(Lane::greater(absY, absX), Lane::sub(Lane::set(HALF_PI), result), result);
+        result = Lane::select(laneX, Lane::sub(Lane::set(PI), result), result);
+
+        Lane::store(angle + index, Lane::bitXor(result, Lane::bitAnd(laneY, signMask)));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        angle[index] = fastAtan2(y[index], x[index]);
+    }
+}
@@ -0,0 +1,317 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    CircularStatistics.cpp
+ * @brief   Circular Statistics Accumulator Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/math/CircularStatistics.h"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /**
+     * @brief Number of samples converted per batch kernel call
+     */
+    constexpr std::size_t BATCH_SIZE = 256;
+
+} // namespace
+
+/**
+ * @brief Class constructor
+ * @param histogramBins Number of histogram bins
+ */
+navis::util::CircularStatistics::CircularStatistics(std::size_t histogramBins)
+  : m_histogram(histogramBins, 0.0)
+{
+}
+
+/**
+ * @brief Add or remove precomputed terms
+ * @param cosine Weighted cosine
+ * @param sine Weighted sine
+ * @param weight Sample weight
+ * @param bin Histogram bin
+ */
+void navis::util::CircularStatistics::addTerm(double cosine, double sine, double weight, std::size_t bin)
+{
+    m_sumCos += cosine;
+    m_sumSin += sine;
+    m_weight += weight;
+    ++m_count;
+
+    if(!m_histogram.empty())
+    {
+        m_histogram[bin] += weight;
+    }
+}
+
+void navis::util::CircularStatistics::removeTerm(double cosine, double sine, double weight, std::size_t bin)
+{
+    assert(m_count > 0);
+    m_sumCos -= cosine;
+    m_sumSin -= sine;
+    m_weight -= weight;
+    --m_count;
+
+    if(!m_histogram.empty())
+    {
+        m_histogram[bin] -= weight;
+    }
+}
+
+/**
+ * @brief Add a sample
+ * @param radians Radian unit value
+ * @param weight Non-negative sample weight
+ */
+void navis::util::CircularStatistics::push(double radians, double weight)
+{
+    double sine, cosine;
+    fastSinCos(radians, sine, cosine);
+    addTerm(weight * cosine, weight * sine, weight, m_histogram.empty() ? 0 : getBin(radians, m_histogram.size()));
+}
+
+/**
+ * @brief Remove a sample added before with the same angle and weight
+ * @param radians Radian unit value
+ * @param weight Sample weight
+ */
+void navis::util::CircularStatistics::pop(double radians, double weight)
+{
+    double sine, cosine;
+    fastSinCos(radians, sine, cosine);
+    removeTerm(weight * cosine, weight * sine, weight, m_histogram.empty() ? 0 : getBin(radians, m_histogram.size()));
+}
+
+/**
+ * @brief Add a buffer of samples
+ * @param radians Radian unit values
+ * @param weights Sample weights (nullptr : unit weights)
+ * @param size Number of samples
+ */
+void navis::util::CircularStatistics::push(const double *radians, const double *weights, std::size_t size)
+{
+    double sines[BATCH_SIZE];
+    double cosines[BATCH_SIZE];
+
+    for(std::size_t offset = 0; offset < size; offset += BATCH_SIZE)
+    {
+        const std::size_t count = (size - offset < BATCH_SIZE) ? size - offset : BATCH_SIZE;
+        fastSinCos(radians + offset, sines, cosines, count);
+
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            const double weight = (weights != nullptr) ? weights[offset + index] : 1.0;
+            m_sumCos += weight * cosines[index];
+            m_sumSin += weight * sines[index];
+            m_weight += weight;
+
+            if(!m_histogram.empty())
+            {
+                m_histogram[getBin(radians[offset + index], m_histogram.size())] += weight;
+            }
+        }
+        m_count += count;
+    }
+}
+
+/**
+ * @brief Add the samples of another accumulator with the same histogram bins
+ * @param other Circular statistics
+ */
+void navis::util::CircularStatistics::merge(const CircularStatistics &other)
+{
+    assert(m_histogram.size() == other.m_histogram.size());
+    m_sumCos += other.m_sumCos;
+    m_sumSin += other.m_sumSin;
+    m_weight += other.m_weight;
+    m_count  += other.m_count;
+
+    for(std::size_t bin = 0; bin < m_histogram.size(); ++bin)
+    {
+        m_histogram[bin] += other.m_histogram[bin];
+    }
+}
+
+/**
+ * @brief Remove every sample, the histogram bins are kept
+ */
+void navis::util::CircularStatistics::reset()
+{
+    m_sumCos = 0.0;
+    m_sumSin = 0.0;
+    m_weight = 0.0;
+    m_count  = 0;
+    m_histogram.assign(m_histogram.size(), 0.0);
+}
+
+/**
+ * @brief Circular mean in [-PI, PI), 0 when the resultant vanishes
+ */
+double navis::util::CircularStatistics::getMean() const
+{
+    return mod2pi(std::atan2(m_sumSin, m_sumCos));
+}
+
+/**
+ * @brief Mean resultant length R in [0, 1]
+ */
+double navis::util::CircularStatistics::getResultantLength() const
+{
+    if(!(m_weight > 0.0))
+    {
+        return 0.0;
+    }
+
+    const double length = std::hypot(m_sumCos, m_sumSin) / m_weight;
+    return (length < 1.0) ? length : 1.0;
+}
+
+/**
+ * @brief Circular standard deviation, sqrt(-2 ln R)
+ */
+double navis::util::CircularStatistics::getStdDev() const
+{
+    const double length = getResultantLength();
+    return (length > 0.0) ? std::sqrt(-2.0 * std::log(length)) : std::numeric_limits<double>::infinity();
+}
+
+/**
+ * @brief Class constructor
+ * @param capacity Window length in samples (non-zero)
+ * @param histogramBins Number of histogram bins
+ */
+navis::util::SlidingCircularStatistics::SlidingCircularStatistics(std::size_t capacity, std::size_t histogramBins)
+  : m_statistics(histogramBins)
+  , m_ring(capacity)
+{
+    assert(capacity > 0);
+}
+
+/**
+ * @brief Rebuild the sums from the window terms
+ */
+void navis::util::SlidingCircularStatistics::resynchronize()
+{
+    m_statistics.reset();
+    for(std::size_t index = 0; index < m_size; ++index)
+    {
+        const Term &term = m_ring[(m_head + index) % m_ring.size()];
+        m_statistics.addTerm(term.cosine, term.sine, term.weight, term.bin);
+    }
+    m_evictions = 0;
+}
+
+/**
+ * @brief Add a sample, the oldest one leaves a full window
+ * @param radians Radian unit value
+ * @param weight Non-negative sample weight
+ */
+void navis::util::SlidingCircularStatistics::push(double radians, double weight)
+{
+    double sine, cosine;
+    fastSinCos(radians, sine, cosine);
+
+    if(m_size == m_ring.size())
+    {
+        pop();
+    }
+
+    const std::size_t binCount = m_statistics.getHistogram().size();
+    Term &term = m_ring[(m_head + m_size) % m_ring.size()];
+    term = {weight * cosine, weight * sine, weight, (binCount > 0) ? CircularStatistics::getBin(radians, binCount) : 0};
+    m_statistics.addTerm(term.cosine, term.sine, term.weight, term.bin);
+    ++m_size;
+}
+
+/**
+ * @brief Add a buffer of samples in order
+ * @param radians Radian unit values
+ * @param weights Sample weights (nullptr : unit weights)
+ * @param size Number of samples
+ */
+void navis::util::SlidingCircularStatistics::push(const double *radians, const double *weights, std::size_t size)
+{
+    // Only the last capacity samples can remain in the window
+    if(size > m_ring.size())
+    {
+        const std::size_t skipped = size - m_ring.size();
+        radians += skipped;
+        weights  = (weights != nullptr) ? weights + skipped : nullptr;
+        size     = m_ring.size();
+        m_statistics.reset();
+        m_head = 0;
+        m_size = 0;
+        m_evictions = 0;
+    }
+
+    double sines[BATCH_SIZE];
+    double cosines[BATCH_SIZE];
+    const std::size_t binCount = m_statistics.getHistogram().size();
+
+    for(std::size_t offset = 0; offset < size; offset += BATCH_SIZE)
+    {
+        const std::size_t count = (size - offset < BATCH_SIZE) ? size - offset : BATCH_SIZE;
+        fastSinCos(radians + offset, sines, cosines, count);
+
+        for(std::size_t index = 0; index < count; ++index)
+        {
+            if(m_size == m_ring.size())
+            {
+                pop();
+            }
+
+            const double weight = (weights != nullptr) ? weights[offset + index] : 1.0;
+            Term &term = m_ring[(m_head + m_size) % m_ring.size()];
+            term = {weight * cosines[index], weight * sines[index], weight, (binCount > 0) ? CircularStatistics::getBin(radians[offset + index], binCount) : 0};
+            m_statistics.addTerm(term.cosine, term.sine, term.weight, term.bin);
+            ++m_size;
+        }
+    }
+}
+
+/**
+ * @brief Remove the oldest sample
+ * @return False when the window is empty
+ */
+bool navis::util::SlidingCircularStatistics::pop()
+{
+    if(m_size == 0)
+    {
+        return false;
+    }
+
+    const Term &term = m_ring[m_head];
+    m_statistics.removeTerm(term.cosine, term.sine, term.weight, term.bin);
+    m_head = (m_head + 1) % m_ring.size();
+    --m_size;
+
+    if(++m_evictions >= m_ring.size())
+    {
+        resynchronize();
+    }
+    return true;
+}
+
+/**
+ * @brief Remove every sample
+ */
+void navis::util::SlidingCircularStatistics::reset()
+{
+    m_statistics.reset();
+    m_head = 0;
+    m_size = 0;
+    m_evictions = 0;
+}
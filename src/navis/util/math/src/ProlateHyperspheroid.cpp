@@ -0,0 +1,223 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ProlateHyperspheroid.cpp
+ * @brief   Prolate Hyperspheroid Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/math/ProlateHyperspheroid.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    /**
+     * @brief Number of points transformed per pass of transformBlock
+     */
+    constexpr std::size_t TRANSFORM_BLOCK_SIZE = 256;
+
+    /**
+     * @brief Euclidean distance between two points
+     */
+    double distance(const double *first, const double *second, std::size_t dimension)
+    {
+        double sum = 0.0;
+        for(std::size_t index = 0; index < dimension; ++index)
+        {
+            double delta = first[index] - second[index];
+            sum += delta * delta;
+        }
+        return std::sqrt(sum);
+    }
+
+} // namespace
+
+/**
+ * @brief Class constructor
+ * @param dimension Dimension of the space
+ * @param focus1 First focus (dimension elements)
+ * @param focus2 Second focus (dimension elements)
+ * @param transverseDiameter Transverse diameter, clamped to the focal distance (default : focal distance)
+ */
+navis::util::ProlateHyperspheroid::ProlateHyperspheroid(std::size_t dimension, const double *focus1, const double *focus2, double transverseDiameter)
+  : m_dimension(dimension)
+  , m_focus1(focus1, focus1 + dimension)
+  , m_focus2(focus2, focus2 + dimension)
+  , m_center(dimension)
+  , m_radii(dimension)
+  , m_minTransverseDiameter(distance(focus1, focus2, dimension))
+  , m_transverseDiameter(std::max(transverseDiameter, m_minTransverseDiameter))
+{
+    for(std::size_t index = 0; index < dimension; ++index)
+    {
+        m_center[index] = 0.5 * (focus1[index] + focus2[index]);
+    }
+
+    // Householder vector v = e1 - a1 reflects the first axis onto the unit focal axis a1
+    if(dimension > 1 && m_minTransverseDiameter > 0.0)
+    {
+        std::vector<double> reflection(dimension);
+        double norm = 0.0;
+        for(std::size_t index = 0; index < dimension; ++index)
+        {
+            double axis = (focus2[index] - focus1[index]) / m_minTransverseDiameter;
+            reflection[index] = ((index == 0) ? 1.0 : 0.0) - axis;
+            norm += reflection[index] * reflection[index];
+        }
+
+        if(norm > 1e-24)
+        {
+            norm = std::sqrt(norm);
+            for(auto &value : reflection)
+            {
+                value /= norm;
+            }
+            m_reflection.swap(reflection);
+        }
+    }
+
+    updateRadii();
+}
+
+/**
+ * @brief Radii update from the current transverse diameter
+ */
+void navis::util::ProlateHyperspheroid::updateRadii()
+{
+    if(m_dimension == 0)
+    {
+        return;
+    }
+
+    double transverse = 0.5 * m_transverseDiameter;
+    double conjugate  = 0.5 * std::sqrt(std::max(0.0, m_transverseDiameter * m_transverseDiameter - m_minTransverseDiameter * m_minTransverseDiameter));
+
+    m_radii[0] = transverse;
+    std::fill(m_radii.begin() + 1, m_radii.end(), conjugate);
+}
+
+/**
+ * @brief Transverse diameter setter method, the rotation stays cached
+ * @param transverseDiameter Transverse diameter (best solution cost)
+ * @return False when it is smaller than the focal distance, the previous value is kept
+ */
+bool navis::util::ProlateHyperspheroid::setTransverseDiameter(double transverseDiameter)
+{
+    if(transverseDiameter < m_minTransverseDiameter)
+    {
+        return false;
+    }
+
+    if(transverseDiameter != m_transverseDiameter)
+    {
+        m_transverseDiameter = transverseDiameter;
+        updateRadii();
+    }
+    return true;
+}
+
+/**
+ * @brief Lebesgue measure of the hyperspheroid
+ */
+double navis::util::ProlateHyperspheroid::getVolume() const
+{
+    const double half = 0.5 * static_cast<double>(m_dimension);
+    double volume = std::pow(M_PI, half) / std::tgamma(half + 1.0);
+
+    for(double radius : m_radii)
+    {
+        volume *= radius;
+    }
+    return volume;
+}
+
+/**
+ * @brief Point containment test
+ * @param point Point (dimension elements)
+ */
+bool navis::util::ProlateHyperspheroid::isInside(const double *point) const
+{
+    return distance(point, m_focus1.data(), m_dimension) + distance(point, m_focus2.data(), m_dimension) <= m_transverseDiameter;
+}
+
+/**
+ * @brief Map a point of the unit ball into the hyperspheroid
+ * @param ball Point in the unit ball (dimension elements)
+ * @param output Transformed point (dimension elements, may alias ball)
+ */
+void navis::util::ProlateHyperspheroid::transform(const double *ball, double *output) const
+{
+    double dot = 0.0;
+    for(std::size_t index = 0; index < m_dimension; ++index)
+    {
+        output[index] = m_radii[index] * ball[index];
+    }
+
+    if(!m_reflection.empty())
+    {
+        for(std::size_t index = 0; index < m_dimension; ++index)
+        {
+            dot += m_reflection[index] * output[index];
+        }
+        dot *= 2.0;
+    }
+
+    for(std::size_t index = 0; index < m_dimension; ++index)
+    {
+        double reflected = m_reflection.empty() ? 0.0 : dot * m_reflection[index];
+        output[index] += m_center[index] - reflected;
+    }
+}
+
+/**
+ * @brief Map points of the unit ball into the hyperspheroid in place (structure-of-arrays layout)
+ *        Component d of point i is stored at buffer[d * stride + i]
+ * @param buffer Point buffer
+ * @param stride Distance between two components of a point
+ * @param size Number of points
+ */
+void navis::util::ProlateHyperspheroid::transformBlock(double *buffer, std::size_t stride, std::size_t size) const
+{
+    double dot[TRANSFORM_BLOCK_SIZE];
+
+    for(std::size_t offset = 0; offset < size; offset += TRANSFORM_BLOCK_SIZE)
+    {
+        const std::size_t count = std::min(TRANSFORM_BLOCK_SIZE, size - offset);
+        std::fill(dot, dot + count, 0.0);
+
+        // Scale and accumulate the reflection dot products row by row
+        for(std::size_t row = 0; row < m_dimension; ++row)
+        {
+            double *values = buffer + row * stride + offset;
+            const double radius = m_radii[row];
+            const double weight = m_reflection.empty() ? 0.0 : 2.0 * m_reflection[row];
+
+            for(std::size_t index = 0; index < count; ++index)
+            {
+                values[index] *= radius;
+                dot[index] += weight * values[index];
+            }
+        }
+
+        for(std::size_t row = 0; row < m_dimension; ++row)
+        {
+            double *values = buffer + row * stride + offset;
+            const double center = m_center[row];
+            const double weight = m_reflection.empty() ? 0.0 : m_reflection[row];
+
+            for(std::size_t index = 0; index < count; ++index)
+            {
+                values[index] += center - weight * dot[index];
+            }
+        }
+    }
+}
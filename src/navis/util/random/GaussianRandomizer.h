@@ -17,9 +17,13 @@
 #define NAVIS_UTIL_RANDOM_GAUSSIANRANDOMIZER_H_
 
 #include "navis/util/random/base/Randomizer.h"
+#include "navis/util/random/distribution/ZigguratNormal.h"
+#include "navis/util/random/distribution/TruncatedNormal.h"
 
+#include <cmath>
 #include <memory>
 #include <random>
+#include <sstream>
 #include <cassert>
 #include <cstdint>
 #include <algorithm>
@@ -29,11 +33,16 @@ namespace navis
     namespace util
     {
         /**
-         * @brief   navis::util::GaussianRandomizer
+         * @brief   navis::util::BasicGaussianRandomizer
          * @details Gaussian random number generator utility
+         * @tparam  EngineType Random number engine, see navis::base::BasicRandomizer
          */
-        class GaussianRandomizer : public navis::base::Randomizer
+        template <typename EngineType>
+        class BasicGaussianRandomizer : public navis::base::BasicRandomizer<EngineType>
         {
+            using Base = navis::base::BasicRandomizer<EngineType>;
+            using Base::m_generator;
+
             private:
 
                 /**
@@ -41,26 +50,46 @@ namespace navis
                  */
                 std::normal_distribution<> m_normalDist{0, 1};
 
+                /**
+                 * @brief Ziggurat standard normal sampler (stateless)
+                 */
+                navis::distribution::ZigguratNormal m_zigguratDist;
+
             public:
 
                 /**
                  * @brief Class constructor
                  * @param NONE Always sets a different random seed
                  * @param localSeed Set to the specified instance seed
+                 * @param key Seed derived from the global seed and the stream key (e.g. "planner/rrt/worker3")
+                 */
+                BasicGaussianRandomizer() = default;
+                BasicGaussianRandomizer(std::uint_fast64_t localSeed);
+                explicit BasicGaussianRandomizer(const navis::base::StreamKey &key);
+
+                /**
+                 * @brief Local random seed setter method and reset distribution
+                 * @param localSeed Local random seed
                  */
-                GaussianRandomizer();
-                GaussianRandomizer(std::uint_fast64_t localSeed);
+                void setLocalSeed(std::uint_fast64_t localSeed);
 
                 /**
-                 * @brief Class destructor
+                 * @brief Stream identifier setter method and reset distribution
+                 * @param streamId Stream identifier
                  */
-                ~GaussianRandomizer() override = default;
+                void setStream(std::uint_fast64_t streamId);
 
                 /**
-                 * @brief Local random seed setter method and reset distribution
-                 * @param localSeed Local random seed
+                 * @brief Snapshot method, seeds, engine state and the cached normal value of gaussianDouble()
+                 */
+                std::vector<std::uint8_t> saveState() const;
+
+                /**
+                 * @brief Restore a snapshot taken by saveState() on a gaussian randomizer of the same engine
+                 * @param bytes Encoded snapshot
+                 * @return False when the snapshot is invalid, nothing is changed
                  */
-                void setLocalSeed(std::uint_fast64_t localSeed) override;
+                bool restoreState(const std::vector<std::uint8_t> &bytes);
 
                 /**
                  * @brief Real random number generation method by gaussian distribution
@@ -69,8 +98,56 @@ namespace navis
                  */
                 double gaussianDouble(const double &mean = 0.0, const double &stdDev = 1.0);
 
+                /**
+                 * @brief Real random number generation method by gaussian distribution (ziggurat method)
+                 *        Same distribution as gaussianDouble() at a fraction of the cost, different sequence
+                 * @param mean Mean of the gaussian distribution (default : 0.0)
+                 * @param stdDev Standard deviation of the gausian distribution (default : 1.0)
+                 */
+                double fastGaussianDouble(double mean = 0.0, double stdDev = 1.0);
+
+                /**
+                 * @brief Fill the buffer with real random numbers by gaussian distribution (ziggurat method)
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param mean Mean of the gaussian distribution (default : 0.0)
+                 * @param stdDev Standard deviation of the gausian distribution (default : 1.0)
+                 */
+                void fillGaussianDouble(double *buffer, std::size_t size, double mean = 0.0, double stdDev = 1.0);
+
+                /**
+                 * @brief Fill the buffer with real random numbers by per-lane gaussian distributions (ziggurat method)
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param mean Mean of each lane (size elements)
+                 * @param stdDev Standard deviation of each lane (size elements)
+                 */
+                void fillGaussianDouble(double *buffer, std::size_t size, const double *mean, const double *stdDev);
+
+                /**
+                 * @brief Real random number generation method by truncated gaussian distribution (exact, no clamping)
+                 * @param lowerBound Lower boundary of the result (may be -infinity)
+                 * @param upperBound Upper boundary of the result (may be +infinity)
+                 * @param mean Mean of the untruncated gaussian distribution (default : 0.0)
+                 * @param stdDev Standard deviation of the untruncated gaussian distribution (default : 1.0)
+                 */
+                double truncatedGaussianDouble(double lowerBound, double upperBound, double mean = 0.0, double stdDev = 1.0);
+
+                /**
+                 * @brief Fill the buffer with real random numbers by truncated gaussian distribution
+                 *        The proposal is selected once for the whole buffer
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param lowerBound Lower boundary of the result (may be -infinity)
+                 * @param upperBound Upper boundary of the result (may be +infinity)
+                 * @param mean Mean of the untruncated gaussian distribution (default : 0.0)
+                 * @param stdDev Standard deviation of the untruncated gaussian distribution (default : 1.0)
+                 */
+                void fillTruncatedGaussianDouble(double *buffer, std::size_t size, double lowerBound, double upperBound, double mean = 0.0, double stdDev = 1.0);
+
                 /**
                  * @brief Real random number generation method by folded gaussian distribution
+                 * @deprecated Folding and clamping put probability spikes at the bounds, use truncatedGaussianDouble()
                  * @param lowerBound Lower boundary of the result
                  * @param upperBound Upper boundary of the result
                  * @param bias Foucusing value around upper boundary
@@ -79,13 +156,209 @@ namespace navis
 
                 /**
                  * @brief Integer random number generation method by folded gaussian distribution
+                 * @deprecated Folding and clamping put probability spikes at the bounds, use truncatedGaussianDouble()
                  * @param lowerBound Lower boundary of the result
                  * @param upperBound Upper boundary of the result
                  * @param bias Foucusing value around upper boundary
                  */
                 int foldedGaussianInt(const int &lowerBound, const int &upperBound, const double &bias = 1.0);
 
-        }; // class GaussianRandomizer
+        }; // class BasicGaussianRandomizer
+
+        /**
+         * @brief Gaussian randomizer with the default engine
+         */
+        using GaussianRandomizer = BasicGaussianRandomizer<navis::base::DefaultEngine>;
+
+        /**
+         * @brief Class constructor
+         * @param localSeed Set to the specified instance seed
+         */
+        template <typename EngineType>
+        BasicGaussianRandomizer<EngineType>::BasicGaussianRandomizer(std::uint_fast64_t localSeed)
+          : Base(localSeed)
+        {
+        }
+
+        /**
+         * @brief Class constructor
+         * @param key Seed derived from the global seed and the stream key
+         */
+        template <typename EngineType>
+        BasicGaussianRandomizer<EngineType>::BasicGaussianRandomizer(const navis::base::StreamKey &key)
+          : Base(key)
+        {
+        }
+
+        /**
+         * @brief Local random seed setter method and reset distribution
+         * @param localSeed Local random seed
+         */
+        template <typename EngineType>
+        void BasicGaussianRandomizer<EngineType>::setLocalSeed(std::uint_fast64_t localSeed)
+        {
+            Base::setLocalSeed(localSeed);
+            m_normalDist.reset();
+        }
+
+        /**
+         * @brief Stream identifier setter method and reset distribution
+         * @param streamId Stream identifier
+         */
+        template <typename EngineType>
+        void BasicGaussianRandomizer<EngineType>::setStream(std::uint_fast64_t streamId)
+        {
+            Base::setStream(streamId);
+            m_normalDist.reset();
+        }
+
+        /**
+         * @brief Snapshot method, seeds, engine state and the cached normal value of gaussianDouble()
+         *        The standard distribution text keeps max_digits10 digits, the cached value is restored exactly
+         */
+        template <typename EngineType>
+        std::vector<std::uint8_t> BasicGaussianRandomizer<EngineType>::saveState() const
+        {
+            std::ostringstream output;
+            output << m_normalDist;
+            return Base::encodeState(output.str());
+        }
+
+        /**
+         * @brief Restore a snapshot taken by saveState() on a gaussian randomizer of the same engine
+         * @param bytes Encoded snapshot
+         * @return False when the snapshot is invalid, nothing is changed
+         */
+        template <typename EngineType>
+        bool BasicGaussianRandomizer<EngineType>::restoreState(const std::vector<std::uint8_t> &bytes)
+        {
+            navis::base::RandomizerState state;
+            if(!Base::decodeState(bytes, state))
+            {
+                return false;
+            }
+
+            std::normal_distribution<> normalDist;
+            std::istringstream input(state.distributionState);
+            input >> normalDist;
+            if(input.fail() || !Base::applyState(state))
+            {
+                return false;
+            }
+
+            m_normalDist = normalDist;
+            return true;
+        }
+
+        /**
+         * @brief Real random number generation method by gaussian distribution
+         * @param mean Mean of the gaussian distribution (default : 0.0)
+         * @param stdDev Standard deviation of the gausian distribution (default : 1.0)
+         */
+        template <typename EngineType>
+        inline double BasicGaussianRandomizer<EngineType>::gaussianDouble(const double &mean, const double &stdDev)
+        {
+            return m_normalDist(m_generator) * stdDev + mean;
+        }
+
+        /**
+         * @brief Real random number generation method by gaussian distribution (ziggurat method)
+         * @param mean Mean of the gaussian distribution (default : 0.0)
+         * @param stdDev Standard deviation of the gausian distribution (default : 1.0)
+         */
+        template <typename EngineType>
+        inline double BasicGaussianRandomizer<EngineType>::fastGaussianDouble(double mean, double stdDev)
+        {
+            return m_zigguratDist(m_generator) * stdDev + mean;
+        }
+
+        /**
+         * @brief Fill the buffer with real random numbers by gaussian distribution (ziggurat method)
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param mean Mean of the gaussian distribution (default : 0.0)
+         * @param stdDev Standard deviation of the gausian distribution (default : 1.0)
+         */
+        template <typename EngineType>
+        void BasicGaussianRandomizer<EngineType>::fillGaussianDouble(double *buffer, std::size_t size, double mean, double stdDev)
+        {
+            m_zigguratDist.fill(m_generator, buffer, size, mean, stdDev);
+        }
+
+        /**
+         * @brief Fill the buffer with real random numbers by per-lane gaussian distributions (ziggurat method)
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param mean Mean of each lane (size elements)
+         * @param stdDev Standard deviation of each lane (size elements)
+         */
+        template <typename EngineType>
+        void BasicGaussianRandomizer<EngineType>::fillGaussianDouble(double *buffer, std::size_t size, const double *mean, const double *stdDev)
+        {
+            m_zigguratDist.fill(m_generator, buffer, size, mean, stdDev);
+        }
+
+        /**
+         * @brief Real random number generation method by truncated gaussian distribution (exact, no clamping)
+         * @param lowerBound Lower boundary of the result (may be -infinity)
+         * @param upperBound Upper boundary of the result (may be +infinity)
+         * @param mean Mean of the untruncated gaussian distribution (default : 0.0)
+         * @param stdDev Standard deviation of the untruncated gaussian distribution (default : 1.0)
+         */
+        template <typename EngineType>
+        inline double BasicGaussianRandomizer<EngineType>::truncatedGaussianDouble(double lowerBound, double upperBound, double mean, double stdDev)
+        {
+            return navis::distribution::TruncatedNormal(lowerBound, upperBound, mean, stdDev)(m_generator);
+        }
+
+        /**
+         * @brief Fill the buffer with real random numbers by truncated gaussian distribution
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param lowerBound Lower boundary of the result (may be -infinity)
+         * @param upperBound Upper boundary of the result (may be +infinity)
+         * @param mean Mean of the untruncated gaussian distribution (default : 0.0)
+         * @param stdDev Standard deviation of the untruncated gaussian distribution (default : 1.0)
+         */
+        template <typename EngineType>
+        void BasicGaussianRandomizer<EngineType>::fillTruncatedGaussianDouble(double *buffer, std::size_t size, double lowerBound, double upperBound, double mean, double stdDev)
+        {
+            navis::distribution::TruncatedNormal(lowerBound, upperBound, mean, stdDev).fill(m_generator, buffer, size);
+        }
+
+        /**
+         * @brief Real random number generation method by folded gaussian distribution
+         * @deprecated Folding and clamping put probability spikes at the bounds, use truncatedGaussianDouble()
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         * @param bias Foucusing value around upper boundary
+         */
+        template <typename EngineType>
+        inline double BasicGaussianRandomizer<EngineType>::foldedGaussianDouble(const double &lowerBound, const double &upperBound, const double &bias)
+        {
+            assert(lowerBound < upperBound);
+            double mean = upperBound - lowerBound;
+            double half = gaussianDouble(mean, mean / bias);
+
+            half = (half > mean) ? (2.0 * mean - half) : half;
+            double result = (half >= 0.0) ? (half + lowerBound) : lowerBound;
+
+            return (result > upperBound) ? upperBound : result;
+        }
+
+        /**
+         * @brief Integer random number generation method by folded gaussian distribution
+         * @deprecated Folding and clamping put probability spikes at the bounds, use truncatedGaussianDouble()
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         * @param bias Foucusing value around upper boundary
+         */
+        template <typename EngineType>
+        inline int BasicGaussianRandomizer<EngineType>::foldedGaussianInt(const int &lowerBound, const int &upperBound, const double &bias)
+        {
+            auto result = (int)std::floor(foldedGaussianDouble((double)lowerBound, (double)(upperBound) + 1.0, bias));
+            return (result > upperBound) ? upperBound : result;
+        }
 
     } // namespace util
 
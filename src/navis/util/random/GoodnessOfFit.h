@@ -0,0 +1,97 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    GoodnessOfFit.h
+ * @brief   Random Sample Goodness-Of-Fit Functions Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_GOODNESSOFFIT_H_
+#define NAVIS_UTIL_RANDOM_GOODNESSOFFIT_H_
+
+#include <cstddef>
+#include <functional>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief Sample moments
+         * @param mean Sample mean
+         * @param variance Unbiased sample variance
+         * @param skewness Sample skewness (0 for a gaussian)
+         * @param excessKurtosis Sample excess kurtosis (0 for a gaussian)
+         */
+        struct SampleMoments
+        {
+            double mean {0.0};
+            double variance {0.0};
+            double skewness {0.0};
+            double excessKurtosis {0.0};
+        };
+
+        /**
+         * @brief Sample moments computation function
+         * @param samples Sample buffer
+         * @param size Number of samples
+         */
+        SampleMoments computeMoments(const double *samples, std::size_t size);
+
+        /**
+         * @brief Standard normal cumulative distribution function
+         * @param x Evaluation point
+         */
+        double normalCdf(double x);
+
+        /**
+         * @brief One-sample Kolmogorov-Smirnov statistic D = sup |F_n(x) - F(x)|
+         * @param samples Sample buffer (copied and sorted internally)
+         * @param size Number of samples
+         * @param cdf Reference cumulative distribution function
+         */
+        double kolmogorovSmirnovStatistic(const double *samples, std::size_t size, const std::function<double(double)> &cdf);
+
+        /**
+         * @brief Asymptotic p-value of the Kolmogorov-Smirnov statistic (Stephens' small sample correction)
+         * @param statistic Kolmogorov-Smirnov statistic D
+         * @param size Number of samples
+         */
+        double kolmogorovSmirnovPValue(double statistic, std::size_t size);
+
+        /**
+         * @brief Pearson chi-square statistic sum (O_i - E_i)^2 / E_i
+         * @param observed Observed bin counts
+         * @param expected Expected bin counts (positive)
+         * @param size Number of bins
+         */
+        double chiSquareStatistic(const double *observed, const double *expected, std::size_t size);
+
+        /**
+         * @brief Upper tail p-value of the chi-square distribution, regularized incomplete gamma Q(k / 2, x / 2)
+         * @param statistic Chi-square statistic
+         * @param degreesOfFreedom Degrees of freedom (non-zero)
+         */
+        double chiSquarePValue(double statistic, std::size_t degreesOfFreedom);
+
+        /**
+         * @brief Pearson correlation coefficient, 0 when either sample is constant
+         *        About N(0, 1 / size) for independent samples
+         * @param first First sample buffer
+         * @param second Second sample buffer
+         * @param size Number of sample pairs
+         */
+        double correlation(const double *first, const double *second, std::size_t size);
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_GOODNESSOFFIT_H_
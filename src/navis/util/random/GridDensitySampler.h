@@ -0,0 +1,350 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    GridDensitySampler.h
+ * @brief   Grid Density Importance Sampler Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_GRIDDENSITYSAMPLER_H_
+#define NAVIS_UTIL_RANDOM_GRIDDENSITYSAMPLER_H_
+
+#include "navis/util/random/distribution/AliasTable.h"
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::GridDensitySampler
+         * @details Importance sampler of positions over a 2-D or 3-D density grid (costmap likelihood, occupancy, ...)
+         *          The grid is cut into tiles of 16 x 16 (2-D) or 8 x 8 x 8 (3-D) cells. Only tiles holding a non-zero cell exist,
+         *          and they keep only their non-zero cells, so memory grows with the non-zero cells rather than the grid size.
+         *          Each tile has an alias table over its cells and a top alias table picks the tile from the tile sums.
+         *          A density update only marks its tile, rebuild() then costs O(tile cells) per dirty tile plus O(number of tiles).
+         *          A draw is a cell picked in proportion to its density plus a uniform jitter inside the cell :
+         *          one 64-bit word for the tile, one for the cell and one per axis, low half first.
+         *          Scalar and block draws consume the words in the same order and return the same positions.
+         */
+        class GridDensitySampler
+        {
+            // "GridDensitySampler" members
+            public:
+
+                static constexpr std::size_t TILE_EDGE_2D = 16;
+                static constexpr std::size_t TILE_EDGE_3D = 8;
+
+            private:
+
+                /**
+                 * @brief Non-zero cells of a tile, sorted by their offset inside the tile
+                 */
+                struct Tile
+                {
+                    std::size_t index;
+                    std::vector<std::uint16_t> offsets;
+                    std::vector<double> densities;
+                    navis::distribution::AliasTable table;
+                };
+
+                std::size_t m_dimension;
+                std::size_t m_size[3];
+                std::size_t m_tileEdge;
+                std::size_t m_tileCount[3];
+                double m_resolution;
+                double m_origin[3];
+
+                std::vector<Tile> m_tiles;
+                std::unordered_map<std::size_t, std::size_t> m_tileSlots;
+                std::vector<double> m_tileWeights;
+                navis::distribution::AliasTable m_top;
+                std::vector<std::size_t> m_dirtyTiles;
+                std::vector<bool> m_isDirty;
+
+            // "GridDensitySampler" methods
+            private:
+
+                /**
+                 * @brief Tile index and offset inside the tile of a cell
+                 * @param x, y, z Cell coordinates
+                 * @param offset Offset inside the tile
+                 */
+                std::size_t locate(std::size_t x, std::size_t y, std::size_t z, std::size_t &offset) const;
+
+                /**
+                 * @brief Mark a tile slot for the next rebuild()
+                 * @param slot Tile slot
+                 */
+                void markDirty(std::size_t slot);
+
+                /**
+                 * @brief Position of a draw, the words are tile, cell and one jitter per axis
+                 * @param words Random words (2 + dimension)
+                 * @param position Output position (dimension elements)
+                 * @param stride Distance between the position components
+                 */
+                void place(const std::uint64_t *words, double *position, std::size_t stride) const;
+
+                /**
+                 * @brief Cell index of a draw
+                 * @param tileWord Tile selection word
+                 * @param cellWord Cell selection word
+                 */
+                std::size_t selectCell(std::uint64_t tileWord, std::uint64_t cellWord) const;
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param sizeX, sizeY, sizeZ Number of cells per axis
+                 * @param resolution Cell edge length [m]
+                 * @param originX, originY, originZ World position of the lower corner of cell (0, 0, 0) [m]
+                 *        The origin has no default, a 3-D grid without one would be taken for a 2-D grid
+                 */
+                GridDensitySampler(std::size_t sizeX, std::size_t sizeY, double resolution, double originX, double originY);
+                GridDensitySampler(std::size_t sizeX, std::size_t sizeY, std::size_t sizeZ, double resolution,
+                                   double originX, double originY, double originZ);
+
+                /**
+                 * @brief Grid dimension getter method, 2 or 3
+                 */
+                std::size_t getDimension() const
+                {
+                    return m_dimension;
+                }
+
+                /**
+                 * @brief Number of cells getter method
+                 */
+                std::size_t getCellCount() const
+                {
+                    return m_size[0] * m_size[1] * m_size[2];
+                }
+
+                /**
+                 * @brief Number of non-zero cells and allocated tiles getter methods
+                 */
+                std::size_t getNonZeroCount() const;
+
+                std::size_t getTileCount() const
+                {
+                    return m_tiles.size();
+                }
+
+                /**
+                 * @brief Sum of the densities getter method, valid after rebuild()
+                 */
+                double getTotalWeight() const
+                {
+                    return m_top.getTotalWeight();
+                }
+
+                /**
+                 * @brief Linear cell index, x runs fastest
+                 * @param x, y, z Cell coordinates
+                 */
+                std::size_t getCellIndex(std::size_t x, std::size_t y, std::size_t z = 0) const
+                {
+                    return x + m_size[0] * (y + m_size[1] * z);
+                }
+
+                /**
+                 * @brief Density getter method
+                 * @param x, y, z Cell coordinates
+                 */
+                double getDensity(std::size_t x, std::size_t y, std::size_t z = 0) const;
+
+                /**
+                 * @brief Density setter method, takes effect on the next rebuild()
+                 * @param x, y, z Cell coordinates
+                 * @param density Non-negative density, zero releases the cell
+                 */
+                void setDensity(std::size_t x, std::size_t y, double density);
+                void setDensity(std::size_t x, std::size_t y, std::size_t z, double density);
+
+                /**
+                 * @brief Replace every density from a dense grid, takes effect on the next rebuild()
+                 * @param densities Non-negative densities (getCellCount() elements, x runs fastest)
+                 */
+                void setDensities(const double *densities);
+
+                /**
+                 * @brief Set a rectangular window of densities, e.g. the updated bounds of a costmap layer
+                 * @param x, y, z Lower corner of the window
+                 * @param width, height, depth Window size in cells
+                 * @param densities Non-negative densities (width * height * depth elements, x runs fastest)
+                 */
+                void setWindow(std::size_t x, std::size_t y, std::size_t z, std::size_t width, std::size_t height, std::size_t depth,
+                               const double *densities);
+
+                /**
+                 * @brief Remove every density and release the tiles
+                 */
+                void clear();
+
+                /**
+                 * @brief Whether density updates are pending
+                 */
+                bool isDirty() const
+                {
+                    return !m_dirtyTiles.empty();
+                }
+
+                /**
+                 * @brief Rebuild the dirty tiles and the top table, emptied tiles are released
+                 * @return False when all densities are zero, the sampler must not be drawn from until densities are set
+                 */
+                bool rebuild();
+
+                /**
+                 * @brief Probability of a cell reconstructed from the tables
+                 * @param x, y, z Cell coordinates
+                 */
+                double getProbability(std::size_t x, std::size_t y, std::size_t z = 0) const;
+
+                /**
+                 * @brief Cell index generation method, O(1)
+                 * @param generator Random number engine
+                 */
+                template <typename Engine>
+                std::size_t sampleCell(Engine &generator) const;
+
+                /**
+                 * @brief Position generation method, O(1)
+                 * @param generator Random number engine
+                 * @param position Output position (getDimension() elements)
+                 */
+                template <typename Engine>
+                void sample(Engine &generator, double *position) const;
+
+                /**
+                 * @brief Block cell index generation method
+                 * @param generator Random number engine
+                 * @param cells Caller-provided output buffer
+                 * @param size Number of cells to generate
+                 */
+                template <typename Engine>
+                void fillCells(Engine &generator, std::size_t *cells, std::size_t size) const;
+
+                /**
+                 * @brief Block position generation method
+                 * @param generator Random number engine
+                 * @param buffer Caller-provided output buffer, structure-of-arrays (buffer[axis * size + i])
+                 * @param size Number of positions to generate
+                 */
+                template <typename Engine>
+                void fill(Engine &generator, double *buffer, std::size_t size) const;
+
+        }; // class GridDensitySampler
+
+        /**
+         * @brief Cell index generation method, O(1)
+         * @param generator Random number engine
+         */
+        template <typename Engine>
+        inline std::size_t GridDensitySampler::sampleCell(Engine &generator) const
+        {
+            assert(!isDirty() && m_top.size() > 0);
+            const std::uint64_t tileWord = navis::engine::EngineTraits<Engine>::next64(generator);
+            return selectCell(tileWord, navis::engine::EngineTraits<Engine>::next64(generator));
+        }
+
+        /**
+         * @brief Position generation method, O(1)
+         * @param generator Random number engine
+         * @param position Output position (getDimension() elements)
+         */
+        template <typename Engine>
+        inline void GridDensitySampler::sample(Engine &generator, double *position) const
+        {
+            assert(!isDirty() && m_top.size() > 0);
+            std::uint64_t words[5];
+            for(std::size_t index = 0; index < 2 + m_dimension; ++index)
+            {
+                words[index] = navis::engine::EngineTraits<Engine>::next64(generator);
+            }
+            place(words, position, 1);
+        }
+
+        /**
+         * @brief Block cell index generation method
+         * @param generator Random number engine
+         * @param cells Caller-provided output buffer
+         * @param size Number of cells to generate
+         */
+        template <typename Engine>
+        void GridDensitySampler::fillCells(Engine &generator, std::size_t *cells, std::size_t size) const
+        {
+            assert(!isDirty() && m_top.size() > 0);
+            constexpr std::size_t blockSize = 256;
+            std::uint32_t words[4 * blockSize];
+
+            while(size > 0)
+            {
+                std::size_t count = (size < blockSize) ? size : blockSize;
+                navis::engine::EngineTraits<Engine>::generateWords(generator, words, 4 * count);
+
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    const std::uint32_t *draw = words + 4 * index;
+                    cells[index] = selectCell(draw[0] | (static_cast<std::uint64_t>(draw[1]) << 32),
+                                              draw[2] | (static_cast<std::uint64_t>(draw[3]) << 32));
+                }
+
+                cells += count;
+                size  -= count;
+            }
+        }
+
+        /**
+         * @brief Block position generation method
+         * @param generator Random number engine
+         * @param buffer Caller-provided output buffer, structure-of-arrays (buffer[axis * size + i])
+         * @param size Number of positions to generate
+         */
+        template <typename Engine>
+        void GridDensitySampler::fill(Engine &generator, double *buffer, std::size_t size) const
+        {
+            assert(!isDirty() && m_top.size() > 0);
+            constexpr std::size_t blockSize = 128;
+            const std::size_t drawWords = 2 + m_dimension;
+            const std::size_t stride = size;
+            std::uint32_t words[2 * 5 * blockSize];
+
+            for(std::size_t offset = 0; offset < size; offset += blockSize)
+            {
+                std::size_t count = (size - offset < blockSize) ? size - offset : blockSize;
+                navis::engine::EngineTraits<Engine>::generateWords(generator, words, 2 * drawWords * count);
+
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    std::uint64_t draw[5];
+                    for(std::size_t word = 0; word < drawWords; ++word)
+                    {
+                        const std::uint32_t *pair = words + 2 * (drawWords * index + word);
+                        draw[word] = pair[0] | (static_cast<std::uint64_t>(pair[1]) << 32);
+                    }
+                    place(draw, buffer + offset + index, stride);
+                }
+            }
+        }
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_GRIDDENSITYSAMPLER_H_
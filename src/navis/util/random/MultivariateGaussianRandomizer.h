@@ -0,0 +1,351 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    MultivariateGaussianRandomizer.h
+ * @brief   Multivariate Gaussian Randomizer Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_MULTIVARIATEGAUSSIANRANDOMIZER_H_
+#define NAVIS_UTIL_RANDOM_MULTIVARIATEGAUSSIANRANDOMIZER_H_
+
+#include "navis/util/random/GaussianRandomizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::BasicMultivariateGaussianRandomizer
+         * @details Correlated gaussian noise generator utility
+         *          The covariance is factored once (L L^T = covariance) and the factor is cached,
+         *          a batch of N samples then costs N standard normal vectors and one triangular product each.
+         * @tparam  EngineType Random number engine, see navis::base::BasicRandomizer
+         */
+        template <typename EngineType>
+        class BasicMultivariateGaussianRandomizer : public BasicGaussianRandomizer<EngineType>
+        {
+            using Base = BasicGaussianRandomizer<EngineType>;
+
+            // "BasicMultivariateGaussianRandomizer" members
+            private:
+
+                /**
+                 * @brief Relative pivot tolerance of the factorization
+                 *        Pivots below it are treated as zero variance directions (positive semi-definite input)
+                 */
+                static constexpr double PIVOT_TOLERANCE = 1e-12;
+
+                std::size_t m_dimension;
+                std::vector<double> m_mean;
+                std::vector<double> m_covariance;
+                std::vector<double> m_choleskyFactor;
+                std::vector<double> m_standardNormal;
+                bool m_isFactorized {false};
+
+            // "BasicMultivariateGaussianRandomizer" methods
+            private:
+
+                /**
+                 * @brief Common constructor body, zero mean and identity covariance
+                 */
+                void initialize();
+
+                /**
+                 * @brief Cholesky factorization of the cached covariance (row-major lower triangle)
+                 * @return False when the covariance is not positive semi-definite
+                 */
+                bool factorize();
+
+            public:
+
+                /**
+                 * @brief Class constructor, zero mean and identity covariance
+                 * @param dimension Dimension of the random vector
+                 * @param localSeed Set to the specified instance seed
+                 * @param key Seed derived from the global seed and the stream key
+                 */
+                explicit BasicMultivariateGaussianRandomizer(std::size_t dimension);
+                BasicMultivariateGaussianRandomizer(std::size_t dimension, std::uint_fast64_t localSeed);
+                BasicMultivariateGaussianRandomizer(std::size_t dimension, const navis::base::StreamKey &key);
+
+                /**
+                 * @brief Dimension getter method
+                 */
+                std::size_t getDimension() const
+                {
+                    return m_dimension;
+                }
+
+                /**
+                 * @brief Mean vector setter method
+                 * @param mean Mean vector (dimension elements)
+                 */
+                void setMean(const double *mean);
+
+                /**
+                 * @brief Covariance matrix setter method
+                 *        The factor is recomputed only when the matrix differs from the cached one
+                 * @param covariance Row-major covariance matrix (dimension * dimension elements, symmetric)
+                 * @return False when the covariance is not positive semi-definite, the previous factor is kept
+                 */
+                bool setCovariance(const double *covariance);
+
+                /**
+                 * @brief Cached lower triangular factor getter method (row-major)
+                 */
+                const std::vector<double> &getCholeskyFactor() const
+                {
+                    return m_choleskyFactor;
+                }
+
+                /**
+                 * @brief Random vector generation method
+                 * @param output Output vector (dimension elements)
+                 */
+                void multivariateGaussian(double *output);
+
+                /**
+                 * @brief Fill the buffer with random vectors in structure-of-arrays layout
+                 *        Component d of sample i is written to buffer[d * size + i]
+                 * @param buffer Caller-provided output buffer (dimension * size elements)
+                 * @param size Number of samples
+                 */
+                void fillMultivariateGaussian(double *buffer, std::size_t size);
+
+        }; // class BasicMultivariateGaussianRandomizer
+
+        /**
+         * @brief Multivariate gaussian randomizer with the default engine
+         */
+        using MultivariateGaussianRandomizer = BasicMultivariateGaussianRandomizer<navis::base::DefaultEngine>;
+
+        /**
+         * @brief Class constructor, zero mean and identity covariance
+         * @param dimension Dimension of the random vector
+         */
+        template <typename EngineType>
+        BasicMultivariateGaussianRandomizer<EngineType>::BasicMultivariateGaussianRandomizer(std::size_t dimension)
+          : Base()
+          , m_dimension(dimension)
+        {
+            initialize();
+        }
+
+        /**
+         * @brief Class constructor, zero mean and identity covariance
+         * @param dimension Dimension of the random vector
+         * @param localSeed Set to the specified instance seed
+         */
+        template <typename EngineType>
+        BasicMultivariateGaussianRandomizer<EngineType>::BasicMultivariateGaussianRandomizer(std::size_t dimension, std::uint_fast64_t localSeed)
+          : Base(localSeed)
+          , m_dimension(dimension)
+        {
+            initialize();
+        }
+
+        /**
+         * @brief Class constructor, zero mean and identity covariance
+         * @param dimension Dimension of the random vector
+         * @param key Seed derived from the global seed and the stream key
+         */
+        template <typename EngineType>
+        BasicMultivariateGaussianRandomizer<EngineType>::BasicMultivariateGaussianRandomizer(std::size_t dimension, const navis::base::StreamKey &key)
+          : Base(key)
+          , m_dimension(dimension)
+        {
+            initialize();
+        }
+
+        /**
+         * @brief Common constructor body, zero mean and identity covariance
+         */
+        template <typename EngineType>
+        void BasicMultivariateGaussianRandomizer<EngineType>::initialize()
+        {
+            m_mean.assign(m_dimension, 0.0);
+            m_covariance.assign(m_dimension * m_dimension, 0.0);
+            m_standardNormal.resize(m_dimension);
+            for(std::size_t index = 0; index < m_dimension; ++index)
+            {
+                m_covariance[index * m_dimension + index] = 1.0;
+            }
+            factorize();
+        }
+
+        /**
+         * @brief Cholesky factorization of the cached covariance (row-major lower triangle)
+         * @return False when the covariance is not positive semi-definite
+         */
+        template <typename EngineType>
+        bool BasicMultivariateGaussianRandomizer<EngineType>::factorize()
+        {
+            const std::size_t dimension = m_dimension;
+            std::vector<double> factor(dimension * dimension, 0.0);
+
+            double scale = 0.0;
+            for(std::size_t index = 0; index < dimension; ++index)
+            {
+                scale = std::max(scale, std::fabs(m_covariance[index * dimension + index]));
+            }
+            const double tolerance = PIVOT_TOLERANCE * std::max(scale, 1.0);
+
+            for(std::size_t column = 0; column < dimension; ++column)
+            {
+                double pivot = m_covariance[column * dimension + column];
+                for(std::size_t k = 0; k < column; ++k)
+                {
+                    pivot -= factor[column * dimension + k] * factor[column * dimension + k];
+                }
+
+                if(pivot < -tolerance)
+                {
+                    return false;
+                }
+
+                // Zero variance direction : the column stays zero, its residual covariances must vanish too
+                const bool isDegenerate = (pivot <= tolerance);
+                const double diagonal = isDegenerate ? 0.0 : std::sqrt(pivot);
+                factor[column * dimension + column] = diagonal;
+
+                for(std::size_t row = column + 1; row < dimension; ++row)
+                {
+                    double value = m_covariance[row * dimension + column];
+                    for(std::size_t k = 0; k < column; ++k)
+                    {
+                        value -= factor[row * dimension + k] * factor[column * dimension + k];
+                    }
+
+                    if(isDegenerate)
+                    {
+                        if(std::fabs(value) > std::sqrt(tolerance))
+                        {
+                            return false;
+                        }
+                        continue;
+                    }
+                    factor[row * dimension + column] = value / diagonal;
+                }
+            }
+
+            m_choleskyFactor.swap(factor);
+            m_isFactorized = true;
+            return true;
+        }
+
+        /**
+         * @brief Mean vector setter method
+         * @param mean Mean vector (dimension elements)
+         */
+        template <typename EngineType>
+        void BasicMultivariateGaussianRandomizer<EngineType>::setMean(const double *mean)
+        {
+            m_mean.assign(mean, mean + m_dimension);
+        }
+
+        /**
+         * @brief Covariance matrix setter method
+         *        The factor is recomputed only when the matrix differs from the cached one
+         * @param covariance Row-major covariance matrix (dimension * dimension elements, symmetric)
+         * @return False when the covariance is not positive semi-definite, the previous factor is kept
+         */
+        template <typename EngineType>
+        bool BasicMultivariateGaussianRandomizer<EngineType>::setCovariance(const double *covariance)
+        {
+            if(m_isFactorized && std::equal(m_covariance.begin(), m_covariance.end(), covariance))
+            {
+                return true;
+            }
+
+            std::vector<double> previous(covariance, covariance + m_dimension * m_dimension);
+            m_covariance.swap(previous);
+
+            if(!factorize())
+            {
+                m_covariance.swap(previous);
+                return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Random vector generation method
+         * @param output Output vector (dimension elements)
+         */
+        template <typename EngineType>
+        void BasicMultivariateGaussianRandomizer<EngineType>::multivariateGaussian(double *output)
+        {
+            const std::size_t dimension = m_dimension;
+            Base::fillGaussianDouble(m_standardNormal.data(), dimension);
+
+            for(std::size_t row = 0; row < dimension; ++row)
+            {
+                double value = m_mean[row];
+                for(std::size_t k = 0; k <= row; ++k)
+                {
+                    value += m_choleskyFactor[row * dimension + k] * m_standardNormal[k];
+                }
+                output[row] = value;
+            }
+        }
+
+        /**
+         * @brief Fill the buffer with random vectors in structure-of-arrays layout
+         *        Component d of sample i is written to buffer[d * size + i]
+         * @param buffer Caller-provided output buffer (dimension * size elements)
+         * @param size Number of samples
+         */
+        template <typename EngineType>
+        void BasicMultivariateGaussianRandomizer<EngineType>::fillMultivariateGaussian(double *buffer, std::size_t size)
+        {
+            const std::size_t dimension = m_dimension;
+            Base::fillGaussianDouble(buffer, dimension * size);
+
+            // In-place x = mean + L z : row d only reads z_k for k <= d, so rows are transformed from the last one
+            for(std::size_t row = dimension; row-- > 0;)
+            {
+                double *target = buffer + row * size;
+                const double *factor = m_choleskyFactor.data() + row * dimension;
+
+                const double diagonal = factor[row];
+                const double mean = m_mean[row];
+                for(std::size_t index = 0; index < size; ++index)
+                {
+                    target[index] = target[index] * diagonal + mean;
+                }
+
+                for(std::size_t k = 0; k < row; ++k)
+                {
+                    const double coefficient = factor[k];
+                    if(coefficient == 0.0)
+                    {
+                        continue;
+                    }
+
+                    const double *source = buffer + k * size;
+                    for(std::size_t index = 0; index < size; ++index)
+                    {
+                        target[index] += coefficient * source[index];
+                    }
+                }
+            }
+        }
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_MULTIVARIATEGAUSSIANRANDOMIZER_H_
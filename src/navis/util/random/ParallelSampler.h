@@ -0,0 +1,305 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ParallelSampler.h
+ * @brief   Parallel Monte Carlo Sampler Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_PARALLELSAMPLER_H_
+#define NAVIS_UTIL_RANDOM_PARALLELSAMPLER_H_
+
+#include "navis/util/random/UniformRandomizer.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::WorkStealingScheduler
+         * @details Runs the chunks [0, chunkCount) on a set of threads, the calling thread included
+         *          Every worker owns a contiguous range of chunks and takes them from the front,
+         *          a worker that runs dry steals the back half of the largest remaining range.
+         *          Ranges are packed in one atomic word, taking and stealing are lock-free.
+         */
+        class WorkStealingScheduler
+        {
+            public:
+
+                /**
+                 * @brief Chunk task, called with the worker index and the chunk index
+                 */
+                using Task = std::function<void(std::size_t, std::size_t)>;
+
+                /**
+                 * @brief Largest number of chunks of one execution (ranges are packed as two 32-bit indices)
+                 */
+                static constexpr std::size_t MAX_CHUNK_COUNT = 0xFFFFFFFFU;
+
+            // "WorkStealingScheduler" methods
+            public:
+
+                /**
+                 * @brief Execute every chunk exactly once, returns when all chunks are done
+                 * @param chunkCount Number of chunks
+                 * @param threadCount Number of workers, the calling thread is worker 0
+                 * @param task Chunk task, must not throw
+                 * @return Number of steals
+                 */
+                static std::uint64_t execute(std::size_t chunkCount, std::size_t threadCount, const Task &task);
+
+                /**
+                 * @brief Default number of workers (hardware concurrency, at least 1)
+                 */
+                static std::size_t getDefaultThreadCount();
+
+        }; // class WorkStealingScheduler
+
+        /**
+         * @brief   navis::util::ParallelSampler
+         * @details Deterministic parallel Monte Carlo driver
+         *          The samples are cut in fixed size chunks, chunk c is drawn from substream c of the run seed
+         *          and the chunk results are reduced in chunk order. The result only depends on the seed, the sample count
+         *          and the chunk size, never on the number of threads or on which thread ran which chunk.
+         * @tparam  RandomizerType Randomizer handed to the kernels (UniformRandomizer, GaussianRandomizer, any engine)
+         */
+        template <typename RandomizerType = UniformRandomizer>
+        class ParallelSampler
+        {
+            public:
+
+                static constexpr std::size_t DEFAULT_CHUNK_SIZE = 4096;
+
+            // "ParallelSampler" members
+            private:
+
+                std::uint_fast64_t m_localSeed;
+                std::uint64_t m_runCount {0};
+                std::size_t m_threadCount;
+                std::size_t m_chunkSize {DEFAULT_CHUNK_SIZE};
+                std::uint64_t m_stealCount {0};
+
+            // "ParallelSampler" methods
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param NONE Always sets a different random seed
+                 * @param localSeed Set to the specified instance seed
+                 * @param key Seed derived from the global seed and the stream key, see navis::base::StreamKey
+                 */
+                ParallelSampler()
+                  : ParallelSampler(navis::base::GlobalSeed::next())
+                {
+                }
+
+                explicit ParallelSampler(std::uint_fast64_t localSeed)
+                  : m_localSeed(localSeed)
+                  , m_threadCount(WorkStealingScheduler::getDefaultThreadCount())
+                {
+                }
+
+                explicit ParallelSampler(const navis::base::StreamKey &key)
+                  : ParallelSampler(navis::base::GlobalSeed::derive(key))
+                {
+                }
+
+                /**
+                 * @brief Local random seed setter method, restarts the run sequence
+                 * @param localSeed Local random seed
+                 */
+                void setLocalSeed(std::uint_fast64_t localSeed)
+                {
+                    m_localSeed = localSeed;
+                    m_runCount  = 0;
+                }
+
+                /**
+                 * @brief Local random seed getter method
+                 */
+                std::uint_fast64_t getLocalSeed() const
+                {
+                    return m_localSeed;
+                }
+
+                /**
+                 * @brief Number of threads setter method, does not change the results
+                 * @param threadCount Number of threads (0 : hardware concurrency)
+                 */
+                void setThreadCount(std::size_t threadCount)
+                {
+                    m_threadCount = (threadCount == 0) ? WorkStealingScheduler::getDefaultThreadCount() : threadCount;
+                }
+
+                /**
+                 * @brief Number of threads getter method
+                 */
+                std::size_t getThreadCount() const
+                {
+                    return m_threadCount;
+                }
+
+                /**
+                 * @brief Chunk size setter method, part of the reproducibility contract like the seed
+                 * @param chunkSize Number of samples per chunk (non-zero)
+                 */
+                void setChunkSize(std::size_t chunkSize)
+                {
+                    assert(chunkSize > 0);
+                    m_chunkSize = chunkSize;
+                }
+
+                /**
+                 * @brief Chunk size getter method
+                 */
+                std::size_t getChunkSize() const
+                {
+                    return m_chunkSize;
+                }
+
+                /**
+                 * @brief Number of chunks stolen between workers during the last run
+                 */
+                std::uint64_t getStealCount() const
+                {
+                    return m_stealCount;
+                }
+
+                /**
+                 * @brief Parallel chunk reduction
+                 *        Every run draws from fresh streams, the sequence of runs is reproducible from the seed
+                 * @param sampleCount Number of samples
+                 * @param identity Identity element of the reduction
+                 * @param kernel Chunk kernel, ResultType(RandomizerType &randomizer, std::uint64_t begin, std::uint64_t end)
+                 * @param reduce Reduction, ResultType(const ResultType &accumulated, const ResultType &chunkResult)
+                 * @return reduce(... reduce(reduce(identity, chunk 0), chunk 1) ..., last chunk)
+                 */
+                template <typename ResultType, typename ChunkKernel, typename ReduceOperation>
+                ResultType reduceChunks(std::uint64_t sampleCount, ResultType identity, ChunkKernel kernel, ReduceOperation reduce);
+
+                /**
+                 * @brief Parallel sample reduction, the samples of a chunk are folded in order
+                 * @param sampleCount Number of samples
+                 * @param identity Identity element of the reduction
+                 * @param kernel Sample kernel, ResultType(RandomizerType &randomizer, std::uint64_t sampleIndex)
+                 * @param reduce Reduction, ResultType(const ResultType &accumulated, const ResultType &value)
+                 */
+                template <typename ResultType, typename SampleKernel, typename ReduceOperation>
+                ResultType reduceSamples(std::uint64_t sampleCount, ResultType identity, SampleKernel kernel, ReduceOperation reduce);
+
+                /**
+                 * @brief Parallel mean of a scalar sample kernel, chunk sums are added in chunk order
+                 * @param sampleCount Number of samples (non-zero)
+                 * @param kernel Sample kernel, double(RandomizerType &randomizer, std::uint64_t sampleIndex)
+                 */
+                template <typename SampleKernel>
+                double mean(std::uint64_t sampleCount, SampleKernel kernel);
+
+        }; // class ParallelSampler
+
+        /**
+         * @brief Parallel chunk reduction
+         * @param sampleCount Number of samples
+         * @param identity Identity element of the reduction
+         * @param kernel Chunk kernel, ResultType(RandomizerType &randomizer, std::uint64_t begin, std::uint64_t end)
+         * @param reduce Reduction, ResultType(const ResultType &accumulated, const ResultType &chunkResult)
+         */
+        template <typename RandomizerType>
+        template <typename ResultType, typename ChunkKernel, typename ReduceOperation>
+        ResultType ParallelSampler<RandomizerType>::reduceChunks(std::uint64_t sampleCount, ResultType identity, ChunkKernel kernel, ReduceOperation reduce)
+        {
+            const std::uint64_t chunkCount = (sampleCount + m_chunkSize - 1) / m_chunkSize;
+            assert(chunkCount <= WorkStealingScheduler::MAX_CHUNK_COUNT);
+
+            const std::uint_fast64_t runSeed = navis::engine::splitMix64(m_localSeed + (++m_runCount) * navis::engine::GOLDEN_GAMMA);
+            const std::size_t threadCount = (chunkCount < m_threadCount) ? static_cast<std::size_t>((chunkCount > 0) ? chunkCount : 1) : m_threadCount;
+
+            // One randomizer per worker, reseeded to the substream of every chunk it runs
+            std::vector<std::unique_ptr<RandomizerType>> randomizers(threadCount);
+            std::vector<ResultType> results(static_cast<std::size_t>(chunkCount), identity);
+
+            m_stealCount = WorkStealingScheduler::execute(static_cast<std::size_t>(chunkCount), threadCount,
+                [&](std::size_t worker, std::size_t chunk)
+                {
+                    if(!randomizers[worker])
+                    {
+                        randomizers[worker].reset(new RandomizerType(runSeed));
+                    }
+                    RandomizerType &randomizer = *randomizers[worker];
+                    randomizer.setStream(chunk);
+
+                    const std::uint64_t begin = static_cast<std::uint64_t>(chunk) * m_chunkSize;
+                    const std::uint64_t end   = (sampleCount - begin < m_chunkSize) ? sampleCount : begin + m_chunkSize;
+                    results[chunk] = kernel(randomizer, begin, end);
+                });
+
+            ResultType accumulated = std::move(identity);
+            for(const ResultType &result : results)
+            {
+                accumulated = reduce(accumulated, result);
+            }
+            return accumulated;
+        }
+
+        /**
+         * @brief Parallel sample reduction, the samples of a chunk are folded in order
+         * @param sampleCount Number of samples
+         * @param identity Identity element of the reduction
+         * @param kernel Sample kernel, ResultType(RandomizerType &randomizer, std::uint64_t sampleIndex)
+         * @param reduce Reduction, ResultType(const ResultType &accumulated, const ResultType &value)
+         */
+        template <typename RandomizerType>
+        template <typename ResultType, typename SampleKernel, typename ReduceOperation>
+        ResultType ParallelSampler<RandomizerType>::reduceSamples(std::uint64_t sampleCount, ResultType identity, SampleKernel kernel, ReduceOperation reduce)
+        {
+            return reduceChunks(sampleCount, identity,
+                [&](RandomizerType &randomizer, std::uint64_t begin, std::uint64_t end)
+                {
+                    ResultType accumulated = identity;
+                    for(std::uint64_t index = begin; index < end; ++index)
+                    {
+                        accumulated = reduce(accumulated, kernel(randomizer, index));
+                    }
+                    return accumulated;
+                },
+                reduce);
+        }
+
+        /**
+         * @brief Parallel mean of a scalar sample kernel, chunk sums are added in chunk order
+         * @param sampleCount Number of samples (non-zero)
+         * @param kernel Sample kernel, double(RandomizerType &randomizer, std::uint64_t sampleIndex)
+         */
+        template <typename RandomizerType>
+        template <typename SampleKernel>
+        double ParallelSampler<RandomizerType>::mean(std::uint64_t sampleCount, SampleKernel kernel)
+        {
+            assert(sampleCount > 0);
+            const double sum = reduceSamples(sampleCount, 0.0, kernel,
+                [](double accumulated, double value)
+                {
+                    return accumulated + value;
+                });
+            return sum / static_cast<double>(sampleCount);
+        }
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_PARALLELSAMPLER_H_
@@ -0,0 +1,648 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    PoissonDiskSampler.h
+ * @brief   Poisson-Disk Spatial Sampler Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_POISSONDISKSAMPLER_H_
+#define NAVIS_UTIL_RANDOM_POISSONDISKSAMPLER_H_
+
+#include "navis/util/math/Angle.h"
+#include "navis/util/math/Pose.h"
+#include "navis/util/random/UniformRandomizer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::PoissonDiskSampler
+         * @details Blue-noise point set in a 2-D or 3-D box (Bridson, "Fast Poisson Disk Sampling in Arbitrary Dimensions", 2007)
+         *          Points grow from an active list : a random active point proposes candidates in the shell [r, 2r] around it,
+         *          the first candidate far enough from every point is kept, a point without one leaves the list.
+         *          Two points are at least max(r_p, r_q) apart, where the radius comes from an optional density function
+         *          clamped to [minRadius, maxRadius]. The background grid has cells of minRadius / sqrt(dimension),
+         *          so it holds at most one point per cell and a conflict test visits O((largest radius / minRadius)^dimension) cells.
+         *          Points are stored as structure-of-arrays, and the same seed gives the same point set.
+         * @tparam  EngineType Random number engine, see navis::base::BasicRandomizer
+         */
+        template <typename EngineType = navis::base::DefaultEngine>
+        class PoissonDiskSampler
+        {
+            // "PoissonDiskSampler" members
+            public:
+
+                static constexpr std::size_t DEFAULT_ATTEMPT_COUNT = 30;
+
+                /**
+                 * @brief Point radius function, receives the position (dimension elements)
+                 */
+                using RadiusFunction = std::function<double(const double *position)>;
+
+            private:
+
+                static constexpr std::uint32_t EMPTY_CELL = 0xFFFFFFFF;
+
+                BasicUniformRandomizer<EngineType> m_randomizer;
+                std::size_t m_dimension;
+                double m_lower[3];
+                double m_upper[3];
+                double m_minRadius;
+                double m_maxRadius;
+                RadiusFunction m_radiusFunction;
+                std::size_t m_attemptCount {DEFAULT_ATTEMPT_COUNT};
+
+                /**
+                 * @brief Background grid of point indices, EMPTY_CELL when the cell has no point
+                 */
+                double m_cellSize;
+                std::size_t m_cellCount[3];
+                std::vector<std::uint32_t> m_grid;
+
+                std::vector<double> m_coordinates[3];
+                std::vector<double> m_radii;
+                std::vector<std::uint32_t> m_active;
+                double m_largestRadius {0.0};
+
+            // "PoissonDiskSampler" methods
+            private:
+
+                /**
+                 * @brief Common constructor body
+                 * @param dimension Space dimension, 2 or 3
+                 * @param lower, upper Box corners
+                 * @param radius Minimum distance between points
+                 */
+                void initialize(std::size_t dimension, const double *lower, const double *upper, double radius);
+
+                /**
+                 * @brief Grid coordinate of a position along an axis
+                 * @param value Position component
+                 * @param axis Axis index
+                 */
+                std::size_t getCell(double value, std::size_t axis) const
+                {
+                    const double cell = std::floor((value - m_lower[axis]) / m_cellSize);
+                    return (cell > 0.0) ? std::min(static_cast<std::size_t>(cell), m_cellCount[axis] - 1) : 0;
+                }
+
+                /**
+                 * @brief Linear grid index of a position
+                 * @param position Position (dimension elements)
+                 */
+                std::size_t getGridIndex(const double *position) const;
+
+                /**
+                 * @brief Radius of a position from the density function
+                 * @param position Position (dimension elements)
+                 */
+                double getRadiusAt(const double *position) const;
+
+                /**
+                 * @brief Whether a position lies in the box and keeps its distance from every point
+                 * @param position Position (dimension elements)
+                 * @param radius Radius of the position
+                 */
+                bool isAcceptable(const double *position, double radius) const;
+
+                /**
+                 * @brief Store a point without checks
+                 * @param position Position (dimension elements)
+                 * @param radius Radius of the point
+                 * @param isActive Whether the point grows new points
+                 */
+                void store(const double *position, double radius, bool isActive);
+
+                /**
+                 * @brief Candidate in the shell [radius, 2 radius] around a point, uniform in volume
+                 * @param index Point index
+                 * @param candidate Output position (dimension elements)
+                 */
+                void propose(std::size_t index, double *candidate);
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param bounds Sampled box, the upper bounds are excluded
+                 * @param radius Minimum distance between points
+                 * @param localSeed Set to the specified instance seed (default : different random seed)
+                 * @param key Seed derived from the global seed and the stream key
+                 */
+                PoissonDiskSampler(const navis::util::Bounds2D &bounds, double radius);
+                PoissonDiskSampler(const navis::util::Bounds2D &bounds, double radius, std::uint_fast64_t localSeed);
+                PoissonDiskSampler(const navis::util::Bounds2D &bounds, double radius, const navis::base::StreamKey &key);
+                PoissonDiskSampler(const navis::util::Bounds3D &bounds, double radius);
+                PoissonDiskSampler(const navis::util::Bounds3D &bounds, double radius, std::uint_fast64_t localSeed);
+                PoissonDiskSampler(const navis::util::Bounds3D &bounds, double radius, const navis::base::StreamKey &key);
+
+                /**
+                 * @brief Variable radius setter method, applies to points added afterwards
+                 *        Dense regions get small radii, e.g. radius = minRadius / sqrt(density) near obstacles or narrow passages
+                 * @param radiusFunction Point radius function (empty : constant minimum radius)
+                 * @param maxRadius Upper clamp of the radius, at least the constructor radius
+                 */
+                void setRadiusFunction(RadiusFunction radiusFunction, double maxRadius);
+
+                /**
+                 * @brief Number of candidates per active point setter method
+                 * @param attemptCount Candidates tried before a point leaves the active list (default : 30)
+                 */
+                void setAttemptCount(std::size_t attemptCount)
+                {
+                    assert(attemptCount > 0);
+                    m_attemptCount = attemptCount;
+                }
+
+                /**
+                 * @brief Add an existing point, e.g. a node of a roadmap that is being extended
+                 * @param position Position (dimension elements)
+                 * @param isActive Whether new points may grow around it (default : true)
+                 * @return False when the point is outside the box or too close to a stored point
+                 */
+                bool insert(const double *position, bool isActive = true);
+
+                /**
+                 * @brief Add a buffer of existing points in order
+                 * @param buffer Positions, structure-of-arrays (buffer[axis * size + i])
+                 * @param size Number of points
+                 * @param isActive Whether new points may grow around them (default : true)
+                 * @return Number of inserted points
+                 */
+                std::size_t insertPoints(const double *buffer, std::size_t size, bool isActive = true);
+
+                /**
+                 * @brief Grow the point set until the active list is empty or maxCount points were added
+                 *        An empty sampler starts from a uniform random point, later calls resume where the previous one stopped
+                 * @param maxCount Maximum number of added points (default : no limit)
+                 * @return Number of added points
+                 */
+                std::size_t generate(std::size_t maxCount = std::numeric_limits<std::size_t>::max());
+
+                /**
+                 * @brief Remove every point, the box, radius settings and engine state are kept
+                 */
+                void reset();
+
+                /**
+                 * @brief Space dimension getter method, 2 or 3
+                 */
+                std::size_t getDimension() const
+                {
+                    return m_dimension;
+                }
+
+                /**
+                 * @brief Number of points getter method
+                 */
+                std::size_t size() const
+                {
+                    return m_radii.size();
+                }
+
+                /**
+                 * @brief Number of points that may still grow new points
+                 */
+                std::size_t getActiveCount() const
+                {
+                    return m_active.size();
+                }
+
+                /**
+                 * @brief Point component getter method
+                 * @param axis Axis index (0 : x, 1 : y, 2 : z)
+                 */
+                const std::vector<double> &getCoordinates(std::size_t axis) const
+                {
+                    assert(axis < m_dimension);
+                    return m_coordinates[axis];
+                }
+
+                /**
+                 * @brief Point radius getter method
+                 */
+                const std::vector<double> &getRadii() const
+                {
+                    return m_radii;
+                }
+
+                /**
+                 * @brief Copy a point
+                 * @param index Point index
+                 * @param position Output position (dimension elements)
+                 */
+                void getPoint(std::size_t index, double *position) const
+                {
+                    for(std::size_t axis = 0; axis < m_dimension; ++axis)
+                    {
+                        position[axis] = m_coordinates[axis][index];
+                    }
+                }
+
+        }; // class PoissonDiskSampler
+
+        /**
+         * @brief Class constructor
+         * @param bounds Sampled box, the upper bounds are excluded
+         * @param radius Minimum distance between points
+         */
+        template <typename EngineType>
+        PoissonDiskSampler<EngineType>::PoissonDiskSampler(const navis::util::Bounds2D &bounds, double radius)
+          : m_randomizer()
+        {
+            const double lower[2] = {bounds.lowerX, bounds.lowerY};
+            const double upper[2] = {bounds.upperX, bounds.upperY};
+            initialize(2, lower, upper, radius);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param bounds Sampled box, the upper bounds are excluded
+         * @param radius Minimum distance between points
+         * @param localSeed Set to the specified instance seed
+         */
+        template <typename EngineType>
+        PoissonDiskSampler<EngineType>::PoissonDiskSampler(const navis::util::Bounds2D &bounds, double radius, std::uint_fast64_t localSeed)
+          : m_randomizer(localSeed)
+        {
+            const double lower[2] = {bounds.lowerX, bounds.lowerY};
+            const double upper[2] = {bounds.upperX, bounds.upperY};
+            initialize(2, lower, upper, radius);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param bounds Sampled box, the upper bounds are excluded
+         * @param radius Minimum distance between points
+         * @param key Seed derived from the global seed and the stream key
+         */
+        template <typename EngineType>
+        PoissonDiskSampler<EngineType>::PoissonDiskSampler(const navis::util::Bounds2D &bounds, double radius, const navis::base::StreamKey &key)
+          : m_randomizer(key)
+        {
+            const double lower[2] = {bounds.lowerX, bounds.lowerY};
+            const double upper[2] = {bounds.upperX, bounds.upperY};
+            initialize(2, lower, upper, radius);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param bounds Sampled box, the upper bounds are excluded
+         * @param radius Minimum distance between points
+         */
+        template <typename EngineType>
+        PoissonDiskSampler<EngineType>::PoissonDiskSampler(const navis::util::Bounds3D &bounds, double radius)
+          : m_randomizer()
+        {
+            const double lower[3] = {bounds.lowerX, bounds.lowerY, bounds.lowerZ};
+            const double upper[3] = {bounds.upperX, bounds.upperY, bounds.upperZ};
+            initialize(3, lower, upper, radius);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param bounds Sampled box, the upper bounds are excluded
+         * @param radius Minimum distance between points
+         * @param localSeed Set to the specified instance seed
+         */
+        template <typename EngineType>
+        PoissonDiskSampler<EngineType>::PoissonDiskSampler(const navis::util::Bounds3D &bounds, double radius, std::uint_fast64_t localSeed)
+          : m_randomizer(localSeed)
+        {
+            const double lower[3] = {bounds.lowerX, bounds.lowerY, bounds.lowerZ};
+            const double upper[3] = {bounds.upperX, bounds.upperY, bounds.upperZ};
+            initialize(3, lower, upper, radius);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param bounds Sampled box, the upper bounds are excluded
+         * @param radius Minimum distance between points
+         * @param key Seed derived from the global seed and the stream key
+         */
+        template <typename EngineType>
+        PoissonDiskSampler<EngineType>::PoissonDiskSampler(const navis::util::Bounds3D &bounds, double radius, const navis::base::StreamKey &key)
+          : m_randomizer(key)
+        {
+            const double lower[3] = {bounds.lowerX, bounds.lowerY, bounds.lowerZ};
+            const double upper[3] = {bounds.upperX, bounds.upperY, bounds.upperZ};
+            initialize(3, lower, upper, radius);
+        }
+
+        /**
+         * @brief Common constructor body
+         * @param dimension Space dimension, 2 or 3
+         * @param lower, upper Box corners
+         * @param radius Minimum distance between points
+         */
+        template <typename EngineType>
+        void PoissonDiskSampler<EngineType>::initialize(std::size_t dimension, const double *lower, const double *upper, double radius)
+        {
+            assert(radius > 0.0);
+            m_dimension = dimension;
+            m_minRadius = radius;
+            m_maxRadius = radius;
+            m_cellSize  = radius / std::sqrt(static_cast<double>(dimension));
+
+            std::size_t gridSize = 1;
+            for(std::size_t axis = 0; axis < 3; ++axis)
+            {
+                const bool isUsed = axis < dimension;
+                m_lower[axis] = isUsed ? lower[axis] : 0.0;
+                m_upper[axis] = isUsed ? upper[axis] : 0.0;
+                assert(!isUsed || m_upper[axis] > m_lower[axis]);
+
+                m_cellCount[axis] = isUsed ? std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil((m_upper[axis] - m_lower[axis]) / m_cellSize))) : 1;
+                gridSize *= m_cellCount[axis];
+            }
+            m_grid.assign(gridSize, EMPTY_CELL);
+        }
+
+        /**
+         * @brief Linear grid index of a position
+         * @param position Position (dimension elements)
+         */
+        template <typename EngineType>
+        inline std::size_t PoissonDiskSampler<EngineType>::getGridIndex(const double *position) const
+        {
+            std::size_t index = 0;
+            for(std::size_t axis = m_dimension; axis-- > 0;)
+            {
+                index = index * m_cellCount[axis] + getCell(position[axis], axis);
+            }
+            return index;
+        }
+
+        /**
+         * @brief Radius of a position from the density function
+         * @param position Position (dimension elements)
+         */
+        template <typename EngineType>
+        inline double PoissonDiskSampler<EngineType>::getRadiusAt(const double *position) const
+        {
+            if(!m_radiusFunction)
+            {
+                return m_minRadius;
+            }
+
+            const double radius = m_radiusFunction(position);
+            return (radius > m_minRadius) ? std::min(radius, m_maxRadius) : m_minRadius;
+        }
+
+        /**
+         * @brief Whether a position lies in the box and keeps its distance from every point
+         * @param position Position (dimension elements)
+         * @param radius Radius of the position
+         */
+        template <typename EngineType>
+        bool PoissonDiskSampler<EngineType>::isAcceptable(const double *position, double radius) const
+        {
+            std::size_t first[3] = {0, 0, 0};
+            std::size_t last[3]  = {0, 0, 0};
+            const std::size_t reach = static_cast<std::size_t>(std::ceil(std::max(radius, m_largestRadius) / m_cellSize));
+
+            for(std::size_t axis = 0; axis < m_dimension; ++axis)
+            {
+                if(!(position[axis] >= m_lower[axis] && position[axis] < m_upper[axis]))
+                {
+                    return false;
+                }
+
+                const std::size_t cell = getCell(position[axis], axis);
+                first[axis] = (cell > reach) ? cell - reach : 0;
+                last[axis]  = std::min(cell + reach, m_cellCount[axis] - 1);
+            }
+
+            for(std::size_t z = first[2]; z <= last[2]; ++z)
+            {
+                for(std::size_t y = first[1]; y <= last[1]; ++y)
+                {
+                    const std::uint32_t *row = m_grid.data() + m_cellCount[0] * (y + m_cellCount[1] * z);
+                    for(std::size_t x = first[0]; x <= last[0]; ++x)
+                    {
+                        const std::uint32_t point = row[x];
+                        if(point == EMPTY_CELL)
+                        {
+                            continue;
+                        }
+
+                        double distance = 0.0;
+                        for(std::size_t axis = 0; axis < m_dimension; ++axis)
+                        {
+                            const double delta = position[axis] - m_coordinates[axis][point];
+                            distance += delta * delta;
+                        }
+
+                        const double spacing = std::max(radius, m_radii[point]);
+                        if(distance < spacing * spacing)
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief Store a point without checks
+         * @param position Position (dimension elements)
+         * @param radius Radius of the point
+         * @param isActive Whether the point grows new points
+         */
+        template <typename EngineType>
+        void PoissonDiskSampler<EngineType>::store(const double *position, double radius, bool isActive)
+        {
+            assert(size() < EMPTY_CELL);
+            const std::uint32_t index = static_cast<std::uint32_t>(size());
+
+            for(std::size_t axis = 0; axis < m_dimension; ++axis)
+            {
+                m_coordinates[axis].push_back(position[axis]);
+            }
+            m_radii.push_back(radius);
+            m_grid[getGridIndex(position)] = index;
+            m_largestRadius = std::max(m_largestRadius, radius);
+
+            if(isActive)
+            {
+                m_active.push_back(index);
+            }
+        }
+
+        /**
+         * @brief Candidate in the shell [radius, 2 radius] around a point, uniform in volume
+         * @param index Point index
+         * @param candidate Output position (dimension elements)
+         */
+        template <typename EngineType>
+        void PoissonDiskSampler<EngineType>::propose(std::size_t index, double *candidate)
+        {
+            const double radius = m_radii[index];
+            const double shell  = m_randomizer.uniformDouble();
+            double distance;
+
+            if(m_dimension == 2)
+            {
+                const double angle = m_randomizer.uniformDouble(-PI, PI);
+                distance = radius * std::sqrt(1.0 + 3.0 * shell);
+                candidate[0] = std::cos(angle);
+                candidate[1] = std::sin(angle);
+            }
+            else
+            {
+                distance = radius * std::cbrt(1.0 + 7.0 * shell);
+                m_randomizer.uniformOnSphere(candidate, 3);
+            }
+
+            for(std::size_t axis = 0; axis < m_dimension; ++axis)
+            {
+                candidate[axis] = m_coordinates[axis][index] + distance * candidate[axis];
+            }
+        }
+
+        /**
+         * @brief Variable radius setter method, applies to points added afterwards
+         * @param radiusFunction Point radius function (empty : constant minimum radius)
+         * @param maxRadius Upper clamp of the radius, at least the constructor radius
+         */
+        template <typename EngineType>
+        void PoissonDiskSampler<EngineType>::setRadiusFunction(RadiusFunction radiusFunction, double maxRadius)
+        {
+            assert(maxRadius >= m_minRadius);
+            m_radiusFunction = std::move(radiusFunction);
+            m_maxRadius = maxRadius;
+        }
+
+        /**
+         * @brief Add an existing point, e.g. a node of a roadmap that is being extended
+         * @param position Position (dimension elements)
+         * @param isActive Whether new points may grow around it
+         * @return False when the point is outside the box or too close to a stored point
+         */
+        template <typename EngineType>
+        bool PoissonDiskSampler<EngineType>::insert(const double *position, bool isActive)
+        {
+            const double radius = getRadiusAt(position);
+            if(!isAcceptable(position, radius))
+            {
+                return false;
+            }
+
+            store(position, radius, isActive);
+            return true;
+        }
+
+        /**
+         * @brief Add a buffer of existing points in order
+         * @param buffer Positions, structure-of-arrays (buffer[axis * size + i])
+         * @param size Number of points
+         * @param isActive Whether new points may grow around them
+         * @return Number of inserted points
+         */
+        template <typename EngineType>
+        std::size_t PoissonDiskSampler<EngineType>::insertPoints(const double *buffer, std::size_t size, bool isActive)
+        {
+            std::size_t count = 0;
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                double position[3];
+                for(std::size_t axis = 0; axis < m_dimension; ++axis)
+                {
+                    position[axis] = buffer[axis * size + index];
+                }
+                count += insert(position, isActive) ? 1 : 0;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Grow the point set until the active list is empty or maxCount points were added
+         * @param maxCount Maximum number of added points
+         * @return Number of added points
+         */
+        template <typename EngineType>
+        std::size_t PoissonDiskSampler<EngineType>::generate(std::size_t maxCount)
+        {
+            std::size_t count = 0;
+            double candidate[3];
+
+            if(m_radii.empty() && maxCount > 0)
+            {
+                for(std::size_t axis = 0; axis < m_dimension; ++axis)
+                {
+                    candidate[axis] = m_randomizer.uniformDouble(m_lower[axis], m_upper[axis]);
+                }
+                store(candidate, getRadiusAt(candidate), true);
+                ++count;
+            }
+
+            while(!m_active.empty() && count < maxCount)
+            {
+                const std::size_t slot = m_randomizer.uniformIndex(m_active.size());
+                const std::size_t point = m_active[slot];
+                bool isFound = false;
+
+                for(std::size_t attempt = 0; attempt < m_attemptCount && !isFound; ++attempt)
+                {
+                    propose(point, candidate);
+                    const double radius = getRadiusAt(candidate);
+                    if(isAcceptable(candidate, radius))
+                    {
+                        store(candidate, radius, true);
+                        isFound = true;
+                    }
+                }
+
+                if(isFound)
+                {
+                    ++count;
+                }
+                else
+                {
+                    m_active[slot] = m_active.back();
+                    m_active.pop_back();
+                }
+            }
+            return count;
+        }
+
+        /**
+         * @brief Remove every point, the box, radius settings and engine state are kept
+         */
+        template <typename EngineType>
+        void PoissonDiskSampler<EngineType>::reset()
+        {
+            for(std::size_t axis = 0; axis < m_dimension; ++axis)
+            {
+                m_coordinates[axis].clear();
+            }
+            m_radii.clear();
+            m_active.clear();
+            m_grid.assign(m_grid.size(), EMPTY_CELL);
+            m_largestRadius = 0.0;
+        }
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_POISSONDISKSAMPLER_H_
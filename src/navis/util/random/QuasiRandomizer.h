@@ -0,0 +1,188 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    QuasiRandomizer.h
+ * @brief   Quasi Randomizer Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_QUASIRANDOMIZER_H_
+#define NAVIS_UTIL_RANDOM_QUASIRANDOMIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::QuasiRandomizer
+         * @details Low-discrepancy sequence generator utility
+         *          Point i of a sequence is a dimension-tuple in [0, 1)^dimension, every point is computed
+         *          directly from its index so workers can generate disjoint index ranges independently.
+         *          The scalar methods mirror navis::util::UniformRandomizer : consecutive calls return
+         *          the coordinates of the current point in order, then move on to the next point.
+         */
+        class QuasiRandomizer
+        {
+            public:
+
+                /**
+                 * @brief Supported low-discrepancy sequences
+                 */
+                enum class Sequence
+                {
+                    HALTON, // Radical inverse in the first primes, random digit permutation when scrambled
+                    SOBOL,  // Joe-Kuo direction numbers (up to MAX_SOBOL_DIMENSION), random digital shift when scrambled
+                    R2      // Additive recurrence on the generalized golden ratio, random shift when scrambled
+                };
+
+                /**
+                 * @brief Largest dimension supported by the Sobol direction number table
+                 */
+                static constexpr std::size_t MAX_SOBOL_DIMENSION = 21;
+
+            // "QuasiRandomizer" members
+            private:
+
+                Sequence m_sequence;
+                std::size_t m_dimension;
+                std::uint64_t m_index {0};
+                std::size_t m_coordinate {0};
+                std::vector<double> m_point;
+
+                /**
+                 * @brief Halton bases and digit permutations (digit d of dimension k at m_permutations[m_offsets[k] + d])
+                 */
+                std::vector<std::uint32_t> m_bases;
+                std::vector<std::uint32_t> m_offsets;
+                std::vector<std::uint32_t> m_permutations;
+
+                /**
+                 * @brief Sobol direction numbers (bit j of dimension k at m_directions[32 * k + j]) and digital shifts
+                 */
+                std::vector<std::uint32_t> m_directions;
+                std::vector<std::uint32_t> m_digitalShifts;
+
+                /**
+                 * @brief R2 increments and shifts as 64-bit fixed point fractions
+                 */
+                std::vector<std::uint64_t> m_increments;
+                std::vector<std::uint64_t> m_shifts;
+
+            // "QuasiRandomizer" methods
+            private:
+
+                /**
+                 * @brief Sequence tables initialization method
+                 * @param scrambleSeed Scrambling seed, unscrambled when 0
+                 */
+                void initialize(std::uint64_t scrambleSeed);
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param sequence Low-discrepancy sequence
+                 * @param dimension Number of coordinates per point
+                 * @param NONE Unscrambled sequence
+                 * @param scrambleSeed Randomized (scrambled) sequence with the specified seed
+                 */
+                QuasiRandomizer(Sequence sequence, std::size_t dimension);
+                QuasiRandomizer(Sequence sequence, std::size_t dimension, std::uint_fast64_t scrambleSeed);
+
+                /**
+                 * @brief Dimension getter method
+                 */
+                std::size_t getDimension() const
+                {
+                    return m_dimension;
+                }
+
+                /**
+                 * @brief Sequence getter method
+                 */
+                Sequence getSequence() const
+                {
+                    return m_sequence;
+                }
+
+                /**
+                 * @brief Index of the next point getter method
+                 */
+                std::uint64_t getIndex() const
+                {
+                    return m_index;
+                }
+
+                /**
+                 * @brief Move to the first coordinate of the specified point, O(1)
+                 * @param index Point index
+                 */
+                void skipTo(std::uint64_t index);
+
+                /**
+                 * @brief Random access point generation method, does not move the sequence
+                 * @param index Point index
+                 * @param output Output point (dimension elements)
+                 */
+                void getPoint(std::uint64_t index, double *output) const;
+
+                /**
+                 * @brief Next point generation method, starts a new point when a previous one is partially consumed
+                 * @param output Output point (dimension elements)
+                 */
+                void nextPoint(double *output);
+
+                /**
+                 * @brief Fill the buffer with consecutive points in structure-of-arrays layout
+                 *        Coordinate d of point i is written to buffer[d * size + i]
+                 * @param buffer Caller-provided output buffer (dimension * size elements)
+                 * @param size Number of points to generate
+                 */
+                void fillPoints(double *buffer, std::size_t size);
+
+                /**
+                 * @brief Next coordinate of the current point mapped to the range
+                 * @param lowerBound Lower boundary of the result (default : 0.0)
+                 * @param upperBound Upper boundary of the result (default : 1.0)
+                 */
+                double uniformDouble(double lowerBound = 0.0, double upperBound = 1.0);
+
+                /**
+                 * @brief Next coordinate of the current point mapped to the integer range
+                 * @param lowerBound Lower boundary of the result
+                 * @param upperBound Upper boundary of the result
+                 */
+                int uniformInt(int lowerBound, int upperBound);
+
+                /**
+                 * @brief Next coordinate of the current point mapped to a boolean
+                 */
+                bool uniformBool();
+
+                /**
+                 * @brief Fill the buffer with consecutive coordinates mapped to the range
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param lowerBound Lower boundary of the result (default : 0.0)
+                 * @param upperBound Upper boundary of the result (default : 1.0)
+                 */
+                void fillUniformDouble(double *buffer, std::size_t size, double lowerBound = 0.0, double upperBound = 1.0);
+
+        }; // class QuasiRandomizer
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_QUASIRANDOMIZER_H_
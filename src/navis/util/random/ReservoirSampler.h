@@ -0,0 +1,308 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ReservoirSampler.h
+ * @brief   Reservoir Sampler Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_RESERVOIRSAMPLER_H_
+#define NAVIS_UTIL_RANDOM_RESERVOIRSAMPLER_H_
+
+#include "navis/util/random/UniformRandomizer.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace navis
+{
+    namespace util
+    {
+        /**
+         * @brief   navis::util::ReservoirSampler
+         * @details Uniform fixed-size subsample of a stream of unknown length (Li's algorithm L, 1994)
+         *          After the reservoir is full the sampler draws the number of items to skip directly,
+         *          so a stream of N items costs O(capacity * (1 + log(N / capacity))) random draws instead of N.
+         * @tparam  DataType Sample type
+         * @tparam  EngineType Random number engine, see navis::base::BasicRandomizer
+         */
+        template <typename DataType, typename EngineType = navis::base::DefaultEngine>
+        class ReservoirSampler
+        {
+            // "ReservoirSampler" members
+            private:
+
+                BasicUniformRandomizer<EngineType> m_randomizer;
+                std::size_t m_capacity;
+                std::vector<DataType> m_samples;
+                std::uint64_t m_seenCount {0};
+
+                /**
+                 * @brief Stream position of the next accepted item and the current largest key weight
+                 */
+                std::uint64_t m_nextAccepted {0};
+                double m_weight {1.0};
+
+            // "ReservoirSampler" methods
+            private:
+
+                /**
+                 * @brief Uniform random number in the open interval (0, 1), keeps the logarithms finite
+                 */
+                double openUniform();
+
+                /**
+                 * @brief Shrink the largest key weight after an accepted item
+                 */
+                void updateWeight();
+
+                /**
+                 * @brief Draw the position of the next accepted item from the current weight
+                 */
+                void scheduleNext();
+
+                /**
+                 * @brief Store an item when its stream position is selected, rejected items are never copied
+                 * @param value Stream item
+                 * @return True when the item was stored
+                 */
+                template <typename ValueType>
+                bool store(ValueType &&value);
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param capacity Number of samples kept
+                 * @param localSeed Set to the specified instance seed (default : different random seed)
+                 * @param key Seed derived from the global seed and the stream key
+                 */
+                explicit ReservoirSampler(std::size_t capacity);
+                ReservoirSampler(std::size_t capacity, std::uint_fast64_t localSeed);
+                ReservoirSampler(std::size_t capacity, const navis::base::StreamKey &key);
+
+                /**
+                 * @brief Offer a stream item to the reservoir
+                 * @param value Stream item
+                 * @return True when the item was stored
+                 */
+                bool offer(const DataType &value);
+                bool offer(DataType &&value);
+
+                /**
+                 * @brief Number of items to skip before the next stored one
+                 *        Callers reading frames in bulk can jump over them without calling offer()
+                 */
+                std::uint64_t getSkipCount() const
+                {
+                    return (m_nextAccepted > m_seenCount) ? m_nextAccepted - m_seenCount : 0;
+                }
+
+                /**
+                 * @brief Skip items of the stream without offering them
+                 * @param count Number of skipped items (at most getSkipCount())
+                 */
+                void skip(std::uint64_t count);
+
+                /**
+                 * @brief Stored samples getter method (unordered)
+                 */
+                const std::vector<DataType> &getSamples() const
+                {
+                    return m_samples;
+                }
+
+                /**
+                 * @brief Number of items seen getter method
+                 */
+                std::uint64_t getSeenCount() const
+                {
+                    return m_seenCount;
+                }
+
+                /**
+                 * @brief Capacity getter method
+                 */
+                std::size_t getCapacity() const
+                {
+                    return m_capacity;
+                }
+
+                /**
+                 * @brief Clear the reservoir for a new stream, the engine is not reseeded
+                 */
+                void reset();
+
+        }; // class ReservoirSampler
+
+        /**
+         * @brief Class constructor
+         * @param capacity Number of samples kept
+         */
+        template <typename DataType, typename EngineType>
+        ReservoirSampler<DataType, EngineType>::ReservoirSampler(std::size_t capacity)
+          : m_randomizer()
+          , m_capacity(capacity)
+        {
+            m_samples.reserve(capacity);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param capacity Number of samples kept
+         * @param localSeed Set to the specified instance seed
+         */
+        template <typename DataType, typename EngineType>
+        ReservoirSampler<DataType, EngineType>::ReservoirSampler(std::size_t capacity, std::uint_fast64_t localSeed)
+          : m_randomizer(localSeed)
+          , m_capacity(capacity)
+        {
+            m_samples.reserve(capacity);
+        }
+
+        /**
+         * @brief Class constructor
+         * @param capacity Number of samples kept
+         * @param key Seed derived from the global seed and the stream key
+         */
+        template <typename DataType, typename EngineType>
+        ReservoirSampler<DataType, EngineType>::ReservoirSampler(std::size_t capacity, const navis::base::StreamKey &key)
+          : m_randomizer(key)
+          , m_capacity(capacity)
+        {
+            m_samples.reserve(capacity);
+        }
+
+        /**
+         * @brief Uniform random number in the open interval (0, 1), keeps the logarithms finite
+         */
+        template <typename DataType, typename EngineType>
+        inline double ReservoirSampler<DataType, EngineType>::openUniform()
+        {
+            double value = m_randomizer.uniformDouble();
+            return (value > 0.0) ? value : std::numeric_limits<double>::min();
+        }
+
+        /**
+         * @brief Shrink the largest key weight after an accepted item
+         */
+        template <typename DataType, typename EngineType>
+        inline void ReservoirSampler<DataType, EngineType>::updateWeight()
+        {
+            m_weight *= std::exp(std::log(openUniform()) / static_cast<double>(m_capacity));
+        }
+
+        /**
+         * @brief Draw the position of the next accepted item from the current weight
+         */
+        template <typename DataType, typename EngineType>
+        void ReservoirSampler<DataType, EngineType>::scheduleNext()
+        {
+            // Geometric number of rejected items, saturated for a vanishing weight
+            double gap = std::floor(std::log(openUniform()) / std::log1p(-m_weight));
+            if(!(gap < 1e18))
+            {
+                gap = 1e18;
+            }
+            m_nextAccepted = m_seenCount + static_cast<std::uint64_t>(gap);
+        }
+
+        /**
+         * @brief Store an item when its stream position is selected, rejected items are never copied
+         * @param value Stream item
+         * @return True when the item was stored
+         */
+        template <typename DataType, typename EngineType>
+        template <typename ValueType>
+        bool ReservoirSampler<DataType, EngineType>::store(ValueType &&value)
+        {
+            const std::uint64_t position = m_seenCount++;
+            if(m_capacity == 0)
+            {
+                return false;
+            }
+
+            if(m_samples.size() < m_capacity)
+            {
+                m_samples.push_back(std::forward<ValueType>(value));
+                if(m_samples.size() == m_capacity)
+                {
+                    updateWeight();
+                    scheduleNext();
+                }
+                return true;
+            }
+
+            if(position != m_nextAccepted)
+            {
+                return false;
+            }
+
+            m_samples[m_randomizer.uniformIndex(m_capacity)] = std::forward<ValueType>(value);
+            updateWeight();
+            scheduleNext();
+            return true;
+        }
+
+        /**
+         * @brief Offer a stream item to the reservoir
+         * @param value Stream item
+         * @return True when the item was stored
+         */
+        template <typename DataType, typename EngineType>
+        bool ReservoirSampler<DataType, EngineType>::offer(const DataType &value)
+        {
+            return store(value);
+        }
+
+        /**
+         * @brief Offer a stream item to the reservoir
+         * @param value Stream item
+         * @return True when the item was stored
+         */
+        template <typename DataType, typename EngineType>
+        bool ReservoirSampler<DataType, EngineType>::offer(DataType &&value)
+        {
+            return store(std::move(value));
+        }
+
+        /**
+         * @brief Skip items of the stream without offering them
+         * @param count Number of skipped items (at most getSkipCount())
+         */
+        template <typename DataType, typename EngineType>
+        void ReservoirSampler<DataType, EngineType>::skip(std::uint64_t count)
+        {
+            assert(count <= getSkipCount());
+            m_seenCount += count;
+        }
+
+        /**
+         * @brief Clear the reservoir for a new stream, the engine is not reseeded
+         */
+        template <typename DataType, typename EngineType>
+        void ReservoirSampler<DataType, EngineType>::reset()
+        {
+            m_samples.clear();
+            m_seenCount = 0;
+            m_nextAccepted = 0;
+            m_weight = 1.0;
+        }
+
+    } // namespace util
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_RESERVOIRSAMPLER_H_
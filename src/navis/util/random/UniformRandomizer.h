@@ -17,54 +17,116 @@
 #define NAVIS_UTIL_RANDOM_UNIFORMRANDOMIZER_H_
 
 #include "navis/util/random/base/Randomizer.h"
+#include "navis/util/random/kernel/UniformKernel.h"
+#include "navis/util/random/distribution/ZigguratNormal.h"
+#include "navis/util/random/distribution/AliasTable.h"
+#include "navis/util/random/distribution/BoundedInteger.h"
+#include "navis/util/math/Pose.h"
+#include "navis/util/math/ProlateHyperspheroid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <unordered_set>
+#include <vector>
 
 namespace navis
 {
     namespace util
     {
         /**
-         * @brief   navis::util::UniformRandomizer
+         * @brief   navis::util::BasicUniformRandomizer
          * @details Uniform random number generator utility
+         *          The fill methods convert blocks of raw words with vector kernels, so their gain over the scalar calls
+         *          depends on the engine : std::mt19937 word generation is serial and dominates, its fills run close to
+         *          the scalar speed, while xoshiro256**, PCG64 and Philox fills run 1.5 to 3 times faster
+         *          (see the "engines" section of util_benchmark)
+         * @tparam  EngineType Random number engine, see navis::base::BasicRandomizer
          */
-        class UniformRandomizer : public navis::base::Randomizer
+        template <typename EngineType>
+        class BasicUniformRandomizer : public navis::base::BasicRandomizer<EngineType>
         {
-            // "UniformRandomizer" members
+            using Base = navis::base::BasicRandomizer<EngineType>;
+            using Base::m_generator;
+
+            // "BasicUniformRandomizer" members
             private:
 
+                /**
+                 * @brief Number of output values converted per random word block
+                 *        Raw random words are staged on the stack before the conversion kernel
+                 */
+                static constexpr std::size_t FILL_BLOCK_SIZE = 256;
+
                 /**
                  * @brief Uniform probability distribution
                  */
                 std::uniform_real_distribution<> m_uniformDist{0, 1};
 
-            // "UniformRandomizer" methods
+                /**
+                 * @brief Standard normal distribution for the direction of sphere and ball samples
+                 */
+                navis::distribution::ZigguratNormal m_normalDist;
+
+            // "BasicUniformRandomizer" methods
+            private:
+
+                /**
+                 * @brief Radius of a uniform ball sample from a uniform variate, u^(1 / dimension)
+                 * @param uniform Uniform variate in [0, 1)
+                 * @param dimension Dimension of the ball (> 0)
+                 */
+                static double ballRadius(double uniform, std::size_t dimension);
+
+                /**
+                 * @brief Fill the buffer with points on the unit sphere or in the unit ball (structure-of-arrays layout)
+                 * @param buffer Caller-provided output buffer (dimension * size elements)
+                 * @param size Number of points to generate
+                 * @param dimension Dimension of the ambient space (> 0)
+                 * @param inBall Scale the directions by a ball radius
+                 */
+                void fillDirection(double *buffer, std::size_t size, std::size_t dimension, bool inBall);
+
             public:
 
                 /**
                  * @brief Class constructor
                  * @param NONE Always sets a different random seed
                  * @param localSeed Set to the specified instance seed
+                 * @param key Seed derived from the global seed and the stream key (e.g. "planner/rrt/worker3")
                  */
-                UniformRandomizer();
-                UniformRandomizer(std::uint_fast64_t localSeed);
+                BasicUniformRandomizer() = default;
+                BasicUniformRandomizer(std::uint_fast64_t localSeed);
+                explicit BasicUniformRandomizer(const navis::base::StreamKey &key);
 
                 /**
-                 * @brief Class destructor
+                 * @brief Local random seed setter method and reset distribution
+                 * @param localSeed Local random seed
                  */
-                ~UniformRandomizer() override = default;
+                void setLocalSeed(std::uint_fast64_t localSeed);
 
                 /**
-                 * @brief Local random seed setter method and reset distribution
-                 * @param localSeed Local random seed
+                 * @brief Stream identifier setter method and reset distribution
+                 * @param streamId Stream identifier
                  */
-                void setLocalSeed(std::uint_fast32_t localSeed) override;
+                void setStream(std::uint_fast64_t streamId);
+
+                /**
+                 * @brief Snapshot and restore methods, see navis::base::BasicRandomizer
+                 *        The uniform distributions cache nothing, the seeds and the engine state are the whole state
+                 */
+                using Base::saveState;
+                using Base::restoreState;
 
                 /**
                  * @brief Real random number generation method by uniform distribution
                  * @param lowerBound Lower boundary of the result (default : 0.0)
                  * @param upperBound Upper boundary of the result (default : 1.0)
                  */
-                
                 double uniformDouble(double lowerBound = 0.0, double upperBound = 1.0);
+
                 /**
                  * @brief Integer random number generation method by uniform distribution
                  * @param lowerBound Lower boundary of the result
@@ -72,21 +134,973 @@ namespace navis
                  */
                 int uniformInt(int lowerBound, int upperBound);
 
+                /**
+                 * @brief 64-bit integer random number generation method by uniform distribution
+                 * @param lowerBound Lower boundary of the result
+                 * @param upperBound Upper boundary of the result
+                 */
+                std::int64_t uniformInt64(std::int64_t lowerBound, std::int64_t upperBound);
+
+                /**
+                 * @brief Index random number generation method by uniform distribution
+                 * @param range Number of indices, the result is in [0, range)
+                 */
+                std::size_t uniformIndex(std::size_t range);
+
                 /**
                  * @brief Boolean random number generation method by uniform distribution
                  */
                 bool uniformBool();
 
-                // @TODO DataType uniformQuaternion()
+                /**
+                 * @brief Fill the buffer with real random numbers by uniform distribution
+                 *        The speedup over uniformDouble() depends on the engine, see the class description
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param lowerBound Lower boundary of the result (default : 0.0)
+                 * @param upperBound Upper boundary of the result (default : 1.0)
+                 */
+                void fillUniformDouble(double *buffer, std::size_t size, double lowerBound = 0.0, double upperBound = 1.0);
+
+                /**
+                 * @brief Fill the buffer with single precision random numbers by uniform distribution
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param lowerBound Lower boundary of the result (default : 0.0)
+                 * @param upperBound Upper boundary of the result (default : 1.0)
+                 */
+                void fillUniformFloat(float *buffer, std::size_t size, float lowerBound = 0.0f, float upperBound = 1.0f);
+
+                /**
+                 * @brief Fill the buffer with integer random numbers by uniform distribution
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param lowerBound Lower boundary of the result
+                 * @param upperBound Upper boundary of the result
+                 */
+                void fillUniformInt(int *buffer, std::size_t size, int lowerBound, int upperBound);
+
+                /**
+                 * @brief Fill the buffer with boolean random numbers by uniform distribution
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 */
+                void fillUniformBool(bool *buffer, std::size_t size);
+
+                /**
+                 * @brief Fill the buffer with indices by uniform distribution
+                 * @param indices Caller-provided output buffer
+                 * @param size Number of indices to generate
+                 * @param range Number of indices, the results are in [0, range)
+                 */
+                void fillUniformIndex(std::size_t *indices, std::size_t size, std::size_t range);
+
+                /**
+                 * @brief Sampling without replacement, count distinct indices of [0, populationSize) in random order
+                 *        Floyd's algorithm for small samples, partial Fisher-Yates shuffle for large ones
+                 * @param indices Caller-provided output buffer (count elements)
+                 * @param count Number of indices to sample (count <= populationSize)
+                 * @param populationSize Number of candidates
+                 */
+                void sampleWithoutReplacement(std::size_t *indices, std::size_t count, std::size_t populationSize);
+
+                /**
+                 * @brief Weighted index generation method, O(1)
+                 * @param table Alias table (navis::distribution::AliasTable or DynamicAliasTable)
+                 */
+                template <typename DiscreteTable>
+                std::size_t discreteIndex(const DiscreteTable &table);
+
+                /**
+                 * @brief Fill the buffer with weighted indices
+                 * @param table Alias table (navis::distribution::AliasTable or DynamicAliasTable)
+                 * @param indices Caller-provided output buffer
+                 * @param size Number of indices to generate
+                 */
+                template <typename DiscreteTable>
+                void fillDiscreteIndex(const DiscreteTable &table, std::size_t *indices, std::size_t size);
+
+                /**
+                 * @brief Systematic resampling, one uniform offset and a single pass over the weights
+                 *        Output indices are sorted and each weight i is selected floor or ceil of size * w_i / sum(w) times
+                 * @param weights Non-negative weights, not all zero
+                 * @param weightCount Number of weights
+                 * @param indices Caller-provided output buffer
+                 * @param size Number of indices to generate
+                 */
+                void systematicResample(const double *weights, std::size_t weightCount, std::size_t *indices, std::size_t size);
+
+                /**
+                 * @brief Stratified resampling, one uniform offset per stratum and a single pass over the weights
+                 * @param weights Non-negative weights, not all zero
+                 * @param weightCount Number of weights
+                 * @param indices Caller-provided output buffer
+                 * @param size Number of indices to generate
+                 */
+                void stratifiedResample(const double *weights, std::size_t weightCount, std::size_t *indices, std::size_t size);
+
+                /**
+                 * @brief Uniformly distributed rotation as a unit quaternion (Shoemake, 1992)
+                 */
+                navis::util::Quaternion uniformQuaternion();
+
+                /**
+                 * @brief Fill the arrays with uniformly distributed rotations as unit quaternions
+                 * @param output Structure-of-arrays output, resized to size
+                 * @param size Number of rotations to generate
+                 */
+                void fillUniformQuaternion(navis::util::QuaternionArray &output, std::size_t size);
+
+                /**
+                 * @brief Uniformly distributed rotation as Z-Y-X euler angles
+                 *        Roll and yaw are uniform in [-PI, PI), pitch follows the cos(pitch) density of the Haar measure
+                 */
+                navis::util::EulerRPY uniformEulerRPY();
+
+                /**
+                 * @brief Fill the arrays with uniformly distributed rotations as Z-Y-X euler angles
+                 * @param output Structure-of-arrays output, resized to size
+                 * @param size Number of rotations to generate
+                 */
+                void fillUniformEulerRPY(navis::util::EulerRPYArray &output, std::size_t size);
 
-                // @TODO DataType uniformEulerRPY()
+                /**
+                 * @brief Uniformly distributed SE(2) pose, yaw in [-PI, PI)
+                 * @param bounds Position bounds
+                 */
+                navis::util::Pose2D uniformPose2D(const navis::util::Bounds2D &bounds);
 
-                // @TODO add sphere data uniform randomization
+                /**
+                 * @brief Fill the arrays with uniformly distributed SE(2) poses
+                 * @param output Structure-of-arrays output, resized to size
+                 * @param size Number of poses to generate
+                 * @param bounds Position bounds
+                 */
+                void fillUniformPose2D(navis::util::Pose2DArray &output, std::size_t size, const navis::util::Bounds2D &bounds);
+
+                /**
+                 * @brief Uniformly distributed SE(3) pose
+                 * @param bounds Position bounds
+                 */
+                navis::util::Pose3D uniformPose3D(const navis::util::Bounds3D &bounds);
+
+                /**
+                 * @brief Fill the arrays with uniformly distributed SE(3) poses
+                 * @param output Structure-of-arrays output, resized to size
+                 * @param size Number of poses to generate
+                 * @param bounds Position bounds
+                 */
+                void fillUniformPose3D(navis::util::Pose3DArray &output, std::size_t size, const navis::util::Bounds3D &bounds);
+
+                /**
+                 * @brief Uniformly distributed point on the unit sphere surface in R^dimension
+                 *        Normalized gaussian vector, cost is linear in the dimension
+                 * @param output Output point (dimension elements)
+                 * @param dimension Dimension of the ambient space (> 0)
+                 */
+                void uniformOnSphere(double *output, std::size_t dimension);
 
-        }; // class UniformRandomizer
+                /**
+                 * @brief Uniformly distributed point inside the unit ball in R^dimension
+                 * @param output Output point (dimension elements)
+                 * @param dimension Dimension of the ball (> 0)
+                 */
+                void uniformInBall(double *output, std::size_t dimension);
+
+                /**
+                 * @brief Uniformly distributed point inside a prolate hyperspheroid
+                 * @param hyperspheroid Informed sampling subset with its cached transform
+                 * @param output Output point (dimension elements)
+                 */
+                void uniformInProlateHyperspheroid(const navis::util::ProlateHyperspheroid &hyperspheroid, double *output);
+
+                /**
+                 * @brief Fill the buffer with points on the unit sphere surface (structure-of-arrays layout)
+                 *        Component d of point i is written to buffer[d * size + i]
+                 * @param buffer Caller-provided output buffer (dimension * size elements)
+                 * @param size Number of points to generate
+                 * @param dimension Dimension of the ambient space (> 0)
+                 */
+                void fillUniformOnSphere(double *buffer, std::size_t size, std::size_t dimension);
+
+                /**
+                 * @brief Fill the buffer with points inside the unit ball (structure-of-arrays layout)
+                 *        Component d of point i is written to buffer[d * size + i]
+                 * @param buffer Caller-provided output buffer (dimension * size elements)
+                 * @param size Number of points to generate
+                 * @param dimension Dimension of the ball (> 0)
+                 */
+                void fillUniformInBall(double *buffer, std::size_t size, std::size_t dimension);
+
+                /**
+                 * @brief Fill the buffer with points inside a prolate hyperspheroid (structure-of-arrays layout)
+                 *        Component d of point i is written to buffer[d * size + i]
+                 * @param hyperspheroid Informed sampling subset with its cached transform
+                 * @param buffer Caller-provided output buffer (dimension * size elements)
+                 * @param size Number of points to generate
+                 */
+                void fillUniformInProlateHyperspheroid(const navis::util::ProlateHyperspheroid &hyperspheroid, double *buffer, std::size_t size);
+
+        }; // class BasicUniformRandomizer
+
+        /**
+         * @brief Uniform randomizer with the default engine
+         */
+        using UniformRandomizer = BasicUniformRandomizer<navis::base::DefaultEngine>;
+
+        /**
+         * @brief Class constructor
+         * @param localSeed Set to the specified instance seed
+         */
+        template <typename EngineType>
+        BasicUniformRandomizer<EngineType>::BasicUniformRandomizer(std::uint_fast64_t localSeed)
+          : Base(localSeed)
+        {
+        }
+
+        /**
+         * @brief Class constructor
+         * @param key Seed derived from the global seed and the stream key
+         */
+        template <typename EngineType>
+        BasicUniformRandomizer<EngineType>::BasicUniformRandomizer(const navis::base::StreamKey &key)
+          : Base(key)
+        {
+        }
+
+        /**
+         * @brief Local random seed setter method and reset distribution
+         * @param localSeed Local random seed
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::setLocalSeed(std::uint_fast64_t localSeed)
+        {
+            Base::setLocalSeed(localSeed);
+            m_uniformDist.reset();
+        }
+
+        /**
+         * @brief Stream identifier setter method and reset distribution
+         * @param streamId Stream identifier
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::setStream(std::uint_fast64_t streamId)
+        {
+            Base::setStream(streamId);
+            m_uniformDist.reset();
+        }
+
+        /**
+         * @brief Real random number generation method by uniform distribution
+         * @param lowerBound Lower boundary of the result (default : 0.0)
+         * @param upperBound Upper boundary of the result (default : 1.0)
+         */
+        template <typename EngineType>
+        inline double BasicUniformRandomizer<EngineType>::uniformDouble(double lowerBound, double upperBound)
+        {
+            assert(lowerBound < upperBound);
+            return (upperBound - lowerBound) * m_uniformDist(m_generator) + lowerBound;
+        }
+
+        /**
+         * @brief Integer random number generation method by uniform distribution
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         */
+        template <typename EngineType>
+        inline int BasicUniformRandomizer<EngineType>::uniformInt(int lowerBound, int upperBound)
+        {
+            assert(lowerBound <= upperBound);
+            const std::uint32_t range = static_cast<std::uint32_t>(static_cast<std::int64_t>(upperBound) - lowerBound + 1);
+            return static_cast<int>(static_cast<std::uint32_t>(lowerBound) + navis::distribution::boundedUInt32(m_generator, range));
+        }
+
+        /**
+         * @brief 64-bit integer random number generation method by uniform distribution
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         */
+        template <typename EngineType>
+        inline std::int64_t BasicUniformRandomizer<EngineType>::uniformInt64(std::int64_t lowerBound, std::int64_t upperBound)
+        {
+            assert(lowerBound <= upperBound);
+            const std::uint64_t range = static_cast<std::uint64_t>(upperBound) - static_cast<std::uint64_t>(lowerBound) + 1;
+            return static_cast<std::int64_t>(static_cast<std::uint64_t>(lowerBound) + navis::distribution::boundedUInt64(m_generator, range));
+        }
+
+        /**
+         * @brief Index random number generation method by uniform distribution
+         * @param range Number of indices, the result is in [0, range)
+         */
+        template <typename EngineType>
+        inline std::size_t BasicUniformRandomizer<EngineType>::uniformIndex(std::size_t range)
+        {
+            assert(range > 0);
+            if(range <= UINT32_MAX)
+            {
+                return navis::distribution::boundedUInt32(m_generator, static_cast<std::uint32_t>(range));
+            }
+            return static_cast<std::size_t>(navis::distribution::boundedUInt64(m_generator, range));
+        }
+
+        /**
+         * @brief Boolean random number generation method by uniform distribution
+         */
+        template <typename EngineType>
+        inline bool BasicUniformRandomizer<EngineType>::uniformBool()
+        {
+            return m_uniformDist(m_generator) < 0.5;
+        }
+
+        /**
+         * @brief Fill the buffer with real random numbers by uniform distribution
+         *        The speedup over uniformDouble() depends on the engine, see the class description
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param lowerBound Lower boundary of the result (default : 0.0)
+         * @param upperBound Upper boundary of the result (default : 1.0)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformDouble(double *buffer, std::size_t size, double lowerBound, double upperBound)
+        {
+            assert(lowerBound < upperBound);
+            std::uint32_t words[FILL_BLOCK_SIZE * navis::kernel::WORDS_PER_DOUBLE];
+
+            while(size > 0)
+            {
+                std::size_t blockSize = std::min(size, FILL_BLOCK_SIZE);
+                Base::EngineTraits::generateWords(m_generator, words, blockSize * navis::kernel::WORDS_PER_DOUBLE);
+                navis::kernel::bitsToDouble(words, buffer, blockSize, lowerBound, upperBound);
+
+                buffer += blockSize;
+                size   -= blockSize;
+            }
+        }
+
+        /**
+         * @brief Fill the buffer with single precision random numbers by uniform distribution
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param lowerBound Lower boundary of the result (default : 0.0)
+         * @param upperBound Upper boundary of the result (default : 1.0)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformFloat(float *buffer, std::size_t size, float lowerBound, float upperBound)
+        {
+            assert(lowerBound < upperBound);
+            std::uint32_t words[FILL_BLOCK_SIZE * navis::kernel::WORDS_PER_FLOAT];
+
+            while(size > 0)
+            {
+                std::size_t blockSize = std::min(size, FILL_BLOCK_SIZE);
+                Base::EngineTraits::generateWords(m_generator, words, blockSize * navis::kernel::WORDS_PER_FLOAT);
+                navis::kernel::bitsToFloat(words, buffer, blockSize, lowerBound, upperBound);
+
+                buffer += blockSize;
+                size   -= blockSize;
+            }
+        }
+
+        /**
+         * @brief Fill the buffer with integer random numbers by uniform distribution
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformInt(int *buffer, std::size_t size, int lowerBound, int upperBound)
+        {
+            assert(lowerBound <= upperBound);
+            std::uint32_t words[FILL_BLOCK_SIZE * navis::kernel::WORDS_PER_INT];
+
+            const std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(upperBound) - lowerBound) + 1;
+            const std::uint32_t threshold = (range <= UINT32_MAX) ? navis::distribution::boundedThreshold32(static_cast<std::uint32_t>(range)) : 0;
+
+            while(size > 0)
+            {
+                std::size_t blockSize = std::min(size, FILL_BLOCK_SIZE);
+                Base::EngineTraits::generateWords(m_generator, words, blockSize * navis::kernel::WORDS_PER_INT);
+                navis::kernel::bitsToInt(words, buffer, blockSize, lowerBound, upperBound);
+
+                // Multiply-shift lanes whose low product half falls below the threshold are biased : redraw them
+                if(range <= UINT32_MAX)
+                {
+                    for(std::size_t index = 0; index < blockSize; ++index)
+                    {
+                        if(static_cast<std::uint32_t>(static_cast<std::uint64_t>(words[index]) * range) < threshold)
+                        {
+                            buffer[index] = static_cast<int>(static_cast<std::uint32_t>(lowerBound) + navis::distribution::boundedUInt32(m_generator, static_cast<std::uint32_t>(range)));
+                        }
+                    }
+                }
+
+                buffer += blockSize;
+                size   -= blockSize;
+            }
+        }
+
+        /**
+         * @brief Fill the buffer with boolean random numbers by uniform distribution
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformBool(bool *buffer, std::size_t size)
+        {
+            constexpr std::size_t blockBools = FILL_BLOCK_SIZE * navis::kernel::BOOLS_PER_WORD;
+            std::uint32_t words[FILL_BLOCK_SIZE];
+
+            while(size > 0)
+            {
+                std::size_t blockSize = std::min(size, blockBools);
+                Base::EngineTraits::generateWords(m_generator, words, (blockSize + navis::kernel::BOOLS_PER_WORD - 1) / navis::kernel::BOOLS_PER_WORD);
+                navis::kernel::bitsToBool(words, buffer, blockSize);
+
+                buffer += blockSize;
+                size   -= blockSize;
+            }
+        }
+
+        /**
+         * @brief Fill the buffer with indices by uniform distribution
+         * @param indices Caller-provided output buffer
+         * @param size Number of indices to generate
+         * @param range Number of indices, the results are in [0, range)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformIndex(std::size_t *indices, std::size_t size, std::size_t range)
+        {
+            assert(range > 0);
+            if(range > UINT32_MAX)
+            {
+                for(std::size_t index = 0; index < size; ++index)
+                {
+                    indices[index] = static_cast<std::size_t>(navis::distribution::boundedUInt64(m_generator, range));
+                }
+                return;
+            }
+
+            const std::uint32_t range32 = static_cast<std::uint32_t>(range);
+            const std::uint32_t threshold = navis::distribution::boundedThreshold32(range32);
+            std::uint32_t words[FILL_BLOCK_SIZE];
+
+            while(size > 0)
+            {
+                std::size_t blockSize = std::min(size, FILL_BLOCK_SIZE);
+                Base::EngineTraits::generateWords(m_generator, words, blockSize);
+
+                for(std::size_t index = 0; index < blockSize; ++index)
+                {
+                    std::uint64_t product = static_cast<std::uint64_t>(words[index]) * range32;
+                    indices[index] = static_cast<std::size_t>(product >> 32);
+                    if(static_cast<std::uint32_t>(product) < threshold)
+                    {
+                        indices[index] = navis::distribution::boundedUInt32(m_generator, range32);
+                    }
+                }
+
+                indices += blockSize;
+                size    -= blockSize;
+            }
+        }
+
+        /**
+         * @brief Sampling without replacement, count distinct indices of [0, populationSize) in random order
+         * @param indices Caller-provided output buffer (count elements)
+         * @param count Number of indices to sample (count <= populationSize)
+         * @param populationSize Number of candidates
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::sampleWithoutReplacement(std::size_t *indices, std::size_t count, std::size_t populationSize)
+        {
+            assert(count <= populationSize);
+            if(count == 0)
+            {
+                return;
+            }
+
+            // Dense sample : partial Fisher-Yates over the whole population
+            if(count * 4 >= populationSize)
+            {
+                std::vector<std::size_t> population(populationSize);
+                std::iota(population.begin(), population.end(), 0);
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    std::size_t other = index + uniformIndex(populationSize - index);
+                    std::swap(population[index], population[other]);
+                    indices[index] = population[index];
+                }
+                return;
+            }
+
+            // Sparse sample : Floyd, one draw per output, duplicates replaced by the newly admitted candidate
+            constexpr std::size_t linearSearchLimit = 64;
+            std::unordered_set<std::size_t> selected;
+            if(count > linearSearchLimit)
+            {
+                selected.reserve(2 * count);
+            }
+
+            std::size_t written = 0;
+            for(std::size_t candidate = populationSize - count; candidate < populationSize; ++candidate)
+            {
+                std::size_t value = uniformIndex(candidate + 1);
+
+                bool isDuplicate;
+                if(count > linearSearchLimit)
+                {
+                    isDuplicate = !selected.insert(value).second;
+                    if(isDuplicate)
+                    {
+                        selected.insert(candidate);
+                    }
+                }
+                else
+                {
+                    isDuplicate = (std::find(indices, indices + written, value) != indices + written);
+                }
+                indices[written++] = isDuplicate ? candidate : value;
+            }
+
+            // Floyd yields a uniform subset but not a uniform order
+            for(std::size_t index = count - 1; index > 0; --index)
+            {
+                std::swap(indices[index], indices[uniformIndex(index + 1)]);
+            }
+        }
+
+        /**
+         * @brief Weighted index generation method, O(1)
+         * @param table Alias table (navis::distribution::AliasTable or DynamicAliasTable)
+         */
+        template <typename EngineType>
+        template <typename DiscreteTable>
+        inline std::size_t BasicUniformRandomizer<EngineType>::discreteIndex(const DiscreteTable &table)
+        {
+            return table(m_generator);
+        }
+
+        /**
+         * @brief Fill the buffer with weighted indices
+         * @param table Alias table (navis::distribution::AliasTable or DynamicAliasTable)
+         * @param indices Caller-provided output buffer
+         * @param size Number of indices to generate
+         */
+        template <typename EngineType>
+        template <typename DiscreteTable>
+        void BasicUniformRandomizer<EngineType>::fillDiscreteIndex(const DiscreteTable &table, std::size_t *indices, std::size_t size)
+        {
+            table.fill(m_generator, indices, size);
+        }
+
+        /**
+         * @brief Systematic resampling, one uniform offset and a single pass over the weights
+         * @param weights Non-negative weights, not all zero
+         * @param weightCount Number of weights
+         * @param indices Caller-provided output buffer
+         * @param size Number of indices to generate
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::systematicResample(const double *weights, std::size_t weightCount, std::size_t *indices, std::size_t size)
+        {
+            double total = 0.0;
+            for(std::size_t index = 0; index < weightCount; ++index)
+            {
+                total += weights[index];
+            }
+            assert(total > 0.0 && weightCount > 0);
+
+            const double step = total / static_cast<double>(size);
+            const double offset = uniformDouble() * step;
+
+            std::size_t current = 0;
+            double cumulative = weights[0];
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                const double target = offset + static_cast<double>(index) * step;
+                while(cumulative <= target && current + 1 < weightCount)
+                {
+                    cumulative += weights[++current];
+                }
+                indices[index] = current;
+            }
+        }
+
+        /**
+         * @brief Stratified resampling, one uniform offset per stratum and a single pass over the weights
+         * @param weights Non-negative weights, not all zero
+         * @param weightCount Number of weights
+         * @param indices Caller-provided output buffer
+         * @param size Number of indices to generate
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::stratifiedResample(const double *weights, std::size_t weightCount, std::size_t *indices, std::size_t size)
+        {
+            double total = 0.0;
+            for(std::size_t index = 0; index < weightCount; ++index)
+            {
+                total += weights[index];
+            }
+            assert(total > 0.0 && weightCount > 0);
+
+            const double step = total / static_cast<double>(size);
+            double offsets[FILL_BLOCK_SIZE];
+
+            std::size_t current = 0;
+            double cumulative = weights[0];
+            for(std::size_t first = 0; first < size; first += FILL_BLOCK_SIZE)
+            {
+                const std::size_t count = std::min(FILL_BLOCK_SIZE, size - first);
+                fillUniformDouble(offsets, count);
+
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    const double target = (static_cast<double>(first + index) + offsets[index]) * step;
+                    while(cumulative <= target && current + 1 < weightCount)
+                    {
+                        cumulative += weights[++current];
+                    }
+                    indices[first + index] = current;
+                }
+            }
+        }
+
+        /**
+         * @brief Uniformly distributed rotation as a unit quaternion (Shoemake, 1992)
+         */
+        template <typename EngineType>
+        navis::util::Quaternion BasicUniformRandomizer<EngineType>::uniformQuaternion()
+        {
+            double u1 = uniformDouble();
+            double theta1 = uniformDouble(0.0, 2.0 * M_PI);
+            double theta2 = uniformDouble(0.0, 2.0 * M_PI);
+
+            double r1 = std::sqrt(1.0 - u1);
+            double r2 = std::sqrt(u1);
+
+            navis::util::Quaternion result;
+            result.x = r1 * std::sin(theta1);
+            result.y = r1 * std::cos(theta1);
+            result.z = r2 * std::sin(theta2);
+            result.w = r2 * std::cos(theta2);
+            return result;
+        }
+
+        /**
+         * @brief Fill the arrays with uniformly distributed rotations as unit quaternions
+         * @param output Structure-of-arrays output, resized to size
+         * @param size Number of rotations to generate
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformQuaternion(navis::util::QuaternionArray &output, std::size_t size)
+        {
+            output.resize(size);
+
+            // Component arrays double as scratch space for the three uniform variates
+            fillUniformDouble(output.w.data(), size);
+            fillUniformDouble(output.x.data(), size, 0.0, 2.0 * M_PI);
+            fillUniformDouble(output.y.data(), size, 0.0, 2.0 * M_PI);
+
+            double *w = output.w.data(), *x = output.x.data(), *y = output.y.data(), *z = output.z.data();
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                double r1 = std::sqrt(1.0 - w[index]);
+                double r2 = std::sqrt(w[index]);
+                double theta1 = x[index];
+                double theta2 = y[index];
+
+                x[index] = r1 * std::sin(theta1);
+                y[index] = r1 * std::cos(theta1);
+                z[index] = r2 * std::sin(theta2);
+                w[index] = r2 * std::cos(theta2);
+            }
+        }
+
+        /**
+         * @brief Uniformly distributed rotation as Z-Y-X euler angles
+         */
+        template <typename EngineType>
+        navis::util::EulerRPY BasicUniformRandomizer<EngineType>::uniformEulerRPY()
+        {
+            navis::util::EulerRPY result;
+            result.roll  = uniformDouble(-M_PI, M_PI);
+            result.pitch = std::asin(uniformDouble(-1.0, 1.0));
+            result.yaw   = uniformDouble(-M_PI, M_PI);
+            return result;
+        }
+
+        /**
+         * @brief Fill the arrays with uniformly distributed rotations as Z-Y-X euler angles
+         * @param output Structure-of-arrays output, resized to size
+         * @param size Number of rotations to generate
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformEulerRPY(navis::util::EulerRPYArray &output, std::size_t size)
+        {
+            output.resize(size);
+            fillUniformDouble(output.roll.data(), size, -M_PI, M_PI);
+            fillUniformDouble(output.pitch.data(), size, -1.0, 1.0);
+            fillUniformDouble(output.yaw.data(), size, -M_PI, M_PI);
+
+            double *pitch = output.pitch.data();
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                pitch[index] = std::asin(pitch[index]);
+            }
+        }
+
+        /**
+         * @brief Uniformly distributed SE(2) pose, yaw in [-PI, PI)
+         * @param bounds Position bounds
+         */
+        template <typename EngineType>
+        navis::util::Pose2D BasicUniformRandomizer<EngineType>::uniformPose2D(const navis::util::Bounds2D &bounds)
+        {
+            navis::util::Pose2D result;
+            result.x   = uniformDouble(bounds.lowerX, bounds.upperX);
+            result.y   = uniformDouble(bounds.lowerY, bounds.upperY);
+            result.yaw = uniformDouble(-M_PI, M_PI);
+            return result;
+        }
+
+        /**
+         * @brief Fill the arrays with uniformly distributed SE(2) poses
+         * @param output Structure-of-arrays output, resized to size
+         * @param size Number of poses to generate
+         * @param bounds Position bounds
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformPose2D(navis::util::Pose2DArray &output, std::size_t size, const navis::util::Bounds2D &bounds)
+        {
+            output.resize(size);
+            fillUniformDouble(output.x.data(), size, bounds.lowerX, bounds.upperX);
+            fillUniformDouble(output.y.data(), size, bounds.lowerY, bounds.upperY);
+            fillUniformDouble(output.yaw.data(), size, -M_PI, M_PI);
+        }
+
+        /**
+         * @brief Uniformly distributed SE(3) pose
+         * @param bounds Position bounds
+         */
+        template <typename EngineType>
+        navis::util::Pose3D BasicUniformRandomizer<EngineType>::uniformPose3D(const navis::util::Bounds3D &bounds)
+        {
+            navis::util::Pose3D result;
+            result.x = uniformDouble(bounds.lowerX, bounds.upperX);
+            result.y = uniformDouble(bounds.lowerY, bounds.upperY);
+            result.z = uniformDouble(bounds.lowerZ, bounds.upperZ);
+            result.orientation = uniformQuaternion();
+            return result;
+        }
+
+        /**
+         * @brief Fill the arrays with uniformly distributed SE(3) poses
+         * @param output Structure-of-arrays output, resized to size
+         * @param size Number of poses to generate
+         * @param bounds Position bounds
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformPose3D(navis::util::Pose3DArray &output, std::size_t size, const navis::util::Bounds3D &bounds)
+        {
+            output.resize(size);
+            fillUniformDouble(output.x.data(), size, bounds.lowerX, bounds.upperX);
+            fillUniformDouble(output.y.data(), size, bounds.lowerY, bounds.upperY);
+            fillUniformDouble(output.z.data(), size, bounds.lowerZ, bounds.upperZ);
+            fillUniformQuaternion(output.orientation, size);
+        }
+
+        /**
+         * @brief Radius of a uniform ball sample from a uniform variate, u^(1 / dimension)
+         * @param uniform Uniform variate in [0, 1)
+         * @param dimension Dimension of the ball (> 0)
+         */
+        template <typename EngineType>
+        inline double BasicUniformRandomizer<EngineType>::ballRadius(double uniform, std::size_t dimension)
+        {
+            switch(dimension)
+            {
+                case 1:  return uniform;
+                case 2:  return std::sqrt(uniform);
+                case 3:  return std::cbrt(uniform);
+                default: return std::pow(uniform, 1.0 / static_cast<double>(dimension));
+            }
+        }
+
+        /**
+         * @brief Fill the buffer with points on the unit sphere or in the unit ball (structure-of-arrays layout)
+         * @param buffer Caller-provided output buffer (dimension * size elements)
+         * @param size Number of points to generate
+         * @param dimension Dimension of the ambient space (> 0)
+         * @param inBall Scale the directions by a ball radius
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillDirection(double *buffer, std::size_t size, std::size_t dimension, bool inBall)
+        {
+            assert(dimension > 0);
+            if(dimension == 0)
+            {
+                return;
+            }
+
+            m_normalDist.fill(m_generator, buffer, dimension * size, 0.0, 1.0);
+
+            double scale[FILL_BLOCK_SIZE];
+            for(std::size_t offset = 0; offset < size; offset += FILL_BLOCK_SIZE)
+            {
+                const std::size_t count = std::min(FILL_BLOCK_SIZE, size - offset);
+                std::fill(scale, scale + count, 0.0);
+
+                for(std::size_t row = 0; row < dimension; ++row)
+                {
+                    const double *values = buffer + row * size + offset;
+                    for(std::size_t index = 0; index < count; ++index)
+                    {
+                        scale[index] += values[index] * values[index];
+                    }
+                }
+
+                // A zero vector has probability ~0 but no direction : redraw that point only
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    while(scale[index] == 0.0)
+                    {
+                        for(std::size_t row = 0; row < dimension; ++row)
+                        {
+                            double value = m_normalDist(m_generator);
+                            buffer[row * size + offset + index] = value;
+                            scale[index] += value * value;
+                        }
+                    }
+                    scale[index] = 1.0 / std::sqrt(scale[index]);
+                }
+
+                if(inBall)
+                {
+                    double radius[FILL_BLOCK_SIZE];
+                    fillUniformDouble(radius, count);
+                    for(std::size_t index = 0; index < count; ++index)
+                    {
+                        scale[index] *= ballRadius(radius[index], dimension);
+                    }
+                }
+
+                for(std::size_t row = 0; row < dimension; ++row)
+                {
+                    double *values = buffer + row * size + offset;
+                    for(std::size_t index = 0; index < count; ++index)
+                    {
+                        values[index] *= scale[index];
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Uniformly distributed point on the unit sphere surface in R^dimension
+         * @param output Output point (dimension elements)
+         * @param dimension Dimension of the ambient space (> 0)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::uniformOnSphere(double *output, std::size_t dimension)
+        {
+            assert(dimension > 0);
+            if(dimension == 0)
+            {
+                return;
+            }
+
+            double norm = 0.0;
+            while(norm == 0.0)
+            {
+                for(std::size_t index = 0; index < dimension; ++index)
+                {
+                    output[index] = m_normalDist(m_generator);
+                    norm += output[index] * output[index];
+                }
+            }
+
+            norm = 1.0 / std::sqrt(norm);
+            for(std::size_t index = 0; index < dimension; ++index)
+            {
+                output[index] *= norm;
+            }
+        }
+
+        /**
+         * @brief Uniformly distributed point inside the unit ball in R^dimension
+         * @param output Output point (dimension elements)
+         * @param dimension Dimension of the ball (> 0)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::uniformInBall(double *output, std::size_t dimension)
+        {
+            assert(dimension > 0);
+            if(dimension == 0)
+            {
+                return;
+            }
+
+            uniformOnSphere(output, dimension);
+
+            double radius = ballRadius(uniformDouble(), dimension);
+            for(std::size_t index = 0; index < dimension; ++index)
+            {
+                output[index] *= radius;
+            }
+        }
+
+        /**
+         * @brief Uniformly distributed point inside a prolate hyperspheroid
+         * @param hyperspheroid Informed sampling subset with its cached transform
+         * @param output Output point (dimension elements)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::uniformInProlateHyperspheroid(const navis::util::ProlateHyperspheroid &hyperspheroid, double *output)
+        {
+            uniformInBall(output, hyperspheroid.getDimension());
+            hyperspheroid.transform(output, output);
+        }
+
+        /**
+         * @brief Fill the buffer with points on the unit sphere surface (structure-of-arrays layout)
+         * @param buffer Caller-provided output buffer (dimension * size elements)
+         * @param size Number of points to generate
+         * @param dimension Dimension of the ambient space (> 0)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformOnSphere(double *buffer, std::size_t size, std::size_t dimension)
+        {
+            fillDirection(buffer, size, dimension, false);
+        }
+
+        /**
+         * @brief Fill the buffer with points inside the unit ball (structure-of-arrays layout)
+         * @param buffer Caller-provided output buffer (dimension * size elements)
+         * @param size Number of points to generate
+         * @param dimension Dimension of the ball (> 0)
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformInBall(double *buffer, std::size_t size, std::size_t dimension)
+        {
+            fillDirection(buffer, size, dimension, true);
+        }
+
+        /**
+         * @brief Fill the buffer with points inside a prolate hyperspheroid (structure-of-arrays layout)
+         * @param hyperspheroid Informed sampling subset with its cached transform
+         * @param buffer Caller-provided output buffer (dimension * size elements)
+         * @param size Number of points to generate
+         */
+        template <typename EngineType>
+        void BasicUniformRandomizer<EngineType>::fillUniformInProlateHyperspheroid(const navis::util::ProlateHyperspheroid &hyperspheroid, double *buffer, std::size_t size)
+        {
+            fillDirection(buffer, size, hyperspheroid.getDimension(), true);
+            hyperspheroid.transformBlock(buffer, size, size);
+        }
 
     } // namespace util
-    
+
 } // namespace navis
 
 #endif // NAVIS_UTIL_RANDOM_UNIFORMRANDOMIZER_H_
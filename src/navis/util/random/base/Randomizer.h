@@ -16,9 +16,15 @@
 #ifndef NAVIS_UTIL_RANDOM_BASE_RANDOMIZER_H_
 #define NAVIS_UTIL_RANDOM_BASE_RANDOMIZER_H_
 
+#include "navis/util/random/base/StreamKey.h"
+#include "navis/util/random/engine/EngineTraits.h"
+
 #include <memory>
 #include <random>
+#include <string>
+#include <vector>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <algorithm>
 
@@ -27,26 +33,146 @@ namespace navis
     namespace base
     {
         /**
-         * @brief   navis::base::Randomizer
+         * @brief Default random number engine type
+         * @details Define NAVIS_RANDOM_COUNTER_BASED_ENGINE to use the counter-based Philox engine,
+         *          which supports O(1) discard and independent parallel streams
+         */
+#if defined(NAVIS_RANDOM_COUNTER_BASED_ENGINE)
+        using DefaultEngine = navis::engine::PhiloxEngine;
+#else
+        using DefaultEngine = std::mt19937;
+#endif
+
+        /**
+         * @brief Seed generator statistics
+         * @param issuedSeeds Number of seeds handed to default constructed randomizers
+         * @param contendedRequests Number of seed requests that overlapped another request on the shared counter
+         * @param estimatedCollisions Estimated number of engine seed collisions, a birthday estimate and not a measurement
+         */
+        struct SeedStatistics
+        {
+            std::uint64_t issuedSeeds {0};
+            std::uint64_t contendedRequests {0};
+            double estimatedCollisions {0.0};
+        };
+
+        /**
+         * @brief   navis::base::GlobalSeed
+         * @details Process wide seed generator shared by every randomizer regardless of its engine
+         */
+        class GlobalSeed
+        {
+            public:
+
+                /**
+                 * @brief Global random seed setter method
+                 * @param globalSeed Global random seed
+                 */
+                static void set(std::uint_fast64_t globalSeed);
+
+                /**
+                 * @brief Global random seed getter method
+                 */
+                static std::uint_fast64_t get();
+
+                /**
+                 * @brief Next local seed getter method, lock-free
+                 */
+                static std::uint_fast64_t next();
+
+                /**
+                 * @brief Local seed of a named stream, lock-free and independent of the request order
+                 * @param key Hierarchical stream key
+                 */
+                static std::uint_fast64_t derive(const StreamKey &key);
+
+                /**
+                 * @brief Seed generator statistics getter method
+                 * @param seedBits Number of seed bits used by the engine
+                 */
+                static SeedStatistics getStatistics(int seedBits);
+
+        }; // class GlobalSeed
+
+        /**
+         * @brief Randomizer snapshot
+         * @param engineType Engine type identifier, see navis::engine::EngineTypeId
+         * @param localSeed Local random seed
+         * @param stream Stream identifier
+         * @param engineState Engine state words, see navis::engine::EngineTraits::saveState()
+         * @param distributionState Cached distribution state (empty when the randomizer has none)
+         */
+        struct RandomizerState
+        {
+            std::uint32_t engineType {0};
+            std::uint_fast64_t localSeed {0};
+            std::uint_fast64_t stream {0};
+            std::vector<std::uint64_t> engineState;
+            std::string distributionState;
+        };
+
+        /**
+         * @brief   navis::base::StateArchive
+         * @details Binary snapshot format, every field little-endian whatever the host :
+         *          "NAVISRNG" magic (8 bytes), format version (4), engine type identifier (4), local seed (8), stream (8),
+         *          engine word count (8), engine words (8 each), distribution state length (8), distribution state bytes
+         */
+        class StateArchive
+        {
+            public:
+
+                static constexpr std::uint32_t VERSION = 2;
+
+                /**
+                 * @brief Snapshot encoding method
+                 * @param state Randomizer snapshot
+                 */
+                static std::vector<std::uint8_t> encode(const RandomizerState &state);
+
+                /**
+                 * @brief Snapshot decoding method
+                 * @param bytes Encoded snapshot
+                 * @param size Number of bytes
+                 * @param state Decoded snapshot
+                 * @return False when the bytes are truncated or not a snapshot of this format version
+                 */
+                static bool decode(const std::uint8_t *bytes, std::size_t size, RandomizerState &state);
+
+        }; // class StateArchive
+
+        /**
+         * @brief   navis::base::BasicRandomizer
          * @details Global random seed and local random seed methods
+         *          The engine is a compile-time policy, there is no virtual dispatch on the sampling path
+         *          Replay : a run is resumed from a saveState() snapshot, which restores any engine in O(state size).
+         *          discard() is only a fast jump for Philox, PCG64 and xoshiro256**, the standard engines have no jump.
+         * @tparam  EngineType UniformRandomBitGenerator producing full 32-bit or 64-bit words
+         *          (std::mt19937, std::mt19937_64, navis::engine::Xoshiro256Engine, Pcg64Engine, PhiloxEngine)
          */
-        class Randomizer
+        template <typename EngineType>
+        class BasicRandomizer
         {
-            // "Randomizer" members
+            public:
+
+                using Engine       = EngineType;
+                using EngineTraits = navis::engine::EngineTraits<EngineType>;
+
+            // "BasicRandomizer" members
             protected:
 
                 std::uint_fast64_t m_localSeed;
-                std::mt19937 m_generator;
+                std::uint_fast64_t m_stream {0};
+                Engine m_generator;
 
-            // "Randomizer" methods
+            // "BasicRandomizer" methods
             private:
 
                 /**
                  * @brief operator overloading
                  * @details non-copyable settings
                  */
-                Randomizer(const Randomizer &) = delete;
-                const Randomizer &operator=(const Randomizer &) = delete;
+                BasicRandomizer(const BasicRandomizer &) = delete;
+                const BasicRandomizer &operator=(const BasicRandomizer &) = delete;
 
             protected:
 
@@ -54,38 +180,191 @@ namespace navis
                  * @brief Class constructor
                  * @param NONE Always sets a different random seed
                  * @param localSeed Set to the specified instance seed
+                 * @param key Seed derived from the global seed and the stream key, replayable whatever the construction order
                  */
-                Randomizer();
-                Randomizer(std::uint_fast64_t localSeed);
+                BasicRandomizer()
+                  : BasicRandomizer(GlobalSeed::next())
+                {
+                }
+
+                explicit BasicRandomizer(const StreamKey &key)
+                  : BasicRandomizer(GlobalSeed::derive(key))
+                {
+                }
+
+                BasicRandomizer(std::uint_fast64_t localSeed)
+                  : m_localSeed(localSeed)
+                  , m_generator(EngineTraits::create(m_localSeed, m_stream))
+                {
+                }
 
                 /**
                  * @brief Class destructor
+                 *        Non-virtual : randomizers are never deleted through the base class
+                 */
+                ~BasicRandomizer() = default;
+
+                /**
+                 * @brief Snapshot encoding method
+                 * @param distributionState Cached distribution state of the derived class
+                 */
+                std::vector<std::uint8_t> encodeState(std::string distributionState) const
+                {
+                    RandomizerState state;
+                    state.engineType        = EngineTraits::TYPE_ID;
+                    state.localSeed         = m_localSeed;
+                    state.stream            = m_stream;
+                    state.distributionState = std::move(distributionState);
+                    EngineTraits::saveState(m_generator, state.engineState);
+                    return StateArchive::encode(state);
+                }
+
+                /**
+                 * @brief Snapshot decoding method, nothing is applied
+                 * @param bytes Encoded snapshot
+                 * @param state Decoded snapshot
+                 * @return False when the bytes are not a snapshot of this engine type or the engine has no type identifier
+                 */
+                static bool decodeState(const std::vector<std::uint8_t> &bytes, RandomizerState &state)
+                {
+                    return EngineTraits::TYPE_ID != 0 && StateArchive::decode(bytes.data(), bytes.size(), state) &&
+                           state.engineType == EngineTraits::TYPE_ID;
+                }
+
+                /**
+                 * @brief Restore the seeds and the engine of a decoded snapshot
+                 * @param state Decoded snapshot
+                 * @return False when the engine words are invalid, nothing is changed
+                 */
+                bool applyState(const RandomizerState &state)
+                {
+                    if(!EngineTraits::loadState(m_generator, state.engineState.data(), state.engineState.size()))
+                    {
+                        return false;
+                    }
+                    m_localSeed = state.localSeed;
+                    m_stream    = state.stream;
+                    return true;
+                }
+
+                /**
+                 * @brief Local random seed setter method
+                 * @param localSeed Local random seed
+                 * @details Protected : derived classes expose it with their distribution reset
+                 */
+                void setLocalSeed(std::uint_fast64_t localSeed)
+                {
+                    m_localSeed = localSeed;
+                    m_stream    = 0;
+                    EngineTraits::seed(m_generator, m_localSeed, m_stream);
+                }
+
+                /**
+                 * @brief Stream identifier setter method
+                 *        Restarts the generator at the beginning of the selected substream of the local seed
+                 * @param streamId Stream identifier (0 is the default stream of the local seed)
+                 * @details Philox and PCG64 select a native substream, the standard engines are reseeded by a seed sequence
+                 *          of the local seed and stream identifier, other engines by a hash of both
+                 *          Protected : derived classes expose it with their distribution reset
+                 */
+                void setStream(std::uint_fast64_t streamId)
+                {
+                    m_stream = streamId;
+                    EngineTraits::seed(m_generator, m_localSeed, m_stream);
+                }
+
+                /**
+                 * @brief Snapshot method, seeds and engine state in the StateArchive binary format
+                 * @details Protected : derived classes expose it with their cached distribution state
                  */
-                virtual ~Randomizer();
+                std::vector<std::uint8_t> saveState() const
+                {
+                    return encodeState(std::string());
+                }
+
+                /**
+                 * @brief Restore a snapshot taken by saveState() on a randomizer of the same type
+                 * @param bytes Encoded snapshot
+                 * @return False when the snapshot is invalid or of another randomizer type, nothing is changed
+                 * @details Protected : derived classes expose it with their cached distribution state
+                 */
+                bool restoreState(const std::vector<std::uint8_t> &bytes)
+                {
+                    RandomizerState state;
+                    return decodeState(bytes, state) && state.distributionState.empty() && applyState(state);
+                }
 
             public:
-                
+
                 /**
                  * @brief Global random seed setter method
                  * @param gloabalSeed Global random seed that is global variable
                  */
-                static void setGlobalSeed(std::uint_fast64_t globalSeed);
+                static void setGlobalSeed(std::uint_fast64_t globalSeed)
+                {
+                    GlobalSeed::set(globalSeed);
+                }
 
                 /**
                  * @brief Global random seed getter method
                  */
-                static std::uint_fast64_t getGlobalSeed();
+                static std::uint_fast64_t getGlobalSeed()
+                {
+                    return GlobalSeed::get();
+                }
 
                 /**
-                 * @brief Local random seed setter method and reset distribution
-                 * @param localSeed Local random seed
+                 * @brief Local seed of a named stream under the current global seed
+                 * @param key Hierarchical stream key
+                 */
+                static std::uint_fast64_t deriveSeed(const StreamKey &key)
+                {
+                    return GlobalSeed::derive(key);
+                }
+
+                /**
+                 * @brief Seed generator statistics getter method
                  */
-                virtual void setLocalSeed(std::uint_fast64_t localSeed);
+                static SeedStatistics getSeedStatistics()
+                {
+                    return GlobalSeed::getStatistics(EngineTraits::SEED_BITS);
+                }
 
                 /**
                  * @brief Local random seed getting method
                  */
-                std::uint_fast64_t getLocalSeed();
+                std::uint_fast64_t getLocalSeed() const
+                {
+                    return m_localSeed;
+                }
+
+                /**
+                 * @brief Stream identifier getter method
+                 */
+                std::uint_fast64_t getStream() const
+                {
+                    return m_stream;
+                }
+
+                /**
+                 * @brief Skip generator outputs, distribution state is kept
+                 * @param count Number of engine outputs to skip
+                 * @details O(1) with Philox, O(log count) with PCG64 and xoshiro256**,
+                 *          O(count) with the standard engines (std::mersenne_twister_engine::discard is linear),
+                 *          to resume a run on those engines restore a saveState() snapshot of the derived class instead
+                 */
+                void discard(unsigned long long count)
+                {
+                    m_generator.discard(count);
+                }
+
+                /**
+                 * @brief Engine accessor method
+                 */
+                Engine &getEngine()
+                {
+                    return m_generator;
+                }
 
                 /**
                  * @brief Shuffle order
@@ -98,10 +377,15 @@ namespace navis
                     std::shuffle(begin, end, m_generator);
                 }
 
-        }; // class Randomizer
+        }; // class BasicRandomizer
+
+        /**
+         * @brief Randomizer base class with the default engine
+         */
+        using Randomizer = BasicRandomizer<DefaultEngine>;
 
     } // namespace base
 
 } // namespace navis
 
-#endif // NAVIS_UTIL_RANDOM_RANDOMIZER_H_
+#endif // NAVIS_UTIL_RANDOM_BASE_RANDOMIZER_H_
@@ -0,0 +1,174 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    StreamKey.h
+ * @brief   Hierarchical Random Stream Key Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_BASE_STREAMKEY_H_
+#define NAVIS_UTIL_RANDOM_BASE_STREAMKEY_H_
+
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace navis
+{
+    namespace base
+    {
+        /**
+         * @brief   navis::base::StreamKey
+         * @details Hierarchical name of a random stream, e.g. "planner/rrt/worker3"
+         *          Each '/' separated segment is hashed (FNV-1a) and chained into the parent hash through splitmix64,
+         *          empty segments are ignored. The local seed of a keyed randomizer only depends on the global seed
+         *          and the key, never on how many randomizers were created before it or by which thread.
+         */
+        class StreamKey
+        {
+            // "StreamKey" members
+            private:
+
+                std::string m_path;
+                std::uint64_t m_hash {0};
+
+            // "StreamKey" methods
+            private:
+
+                /**
+                 * @brief FNV-1a hash of a path segment
+                 * @param segment First character of the segment
+                 * @param length Number of characters
+                 */
+                static std::uint64_t hashSegment(const char *segment, std::size_t length)
+                {
+                    std::uint64_t hash = 0xCBF29CE484222325ULL;
+                    for(std::size_t index = 0; index < length; ++index)
+                    {
+                        hash ^= static_cast<unsigned char>(segment[index]);
+                        hash *= 0x100000001B3ULL;
+                    }
+                    return hash;
+                }
+
+                /**
+                 * @brief Append the segments of a relative path
+                 * @param path '/' separated path
+                 */
+                void append(const std::string &path)
+                {
+                    std::size_t begin = 0;
+                    while(begin <= path.size())
+                    {
+                        std::size_t end = path.find('/', begin);
+                        if(end == std::string::npos)
+                        {
+                            end = path.size();
+                        }
+
+                        if(end > begin)
+                        {
+                            if(!m_path.empty())
+                            {
+                                m_path.push_back('/');
+                            }
+                            m_path.append(path, begin, end - begin);
+                            m_hash = navis::engine::splitMix64(m_hash ^ hashSegment(path.data() + begin, end - begin));
+                        }
+                        begin = end + 1;
+                    }
+                }
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param NONE Root key
+                 * @param path '/' separated path
+                 */
+                StreamKey() = default;
+
+                StreamKey(const std::string &path)
+                {
+                    append(path);
+                }
+
+                StreamKey(const char *path)
+                  : StreamKey(std::string(path))
+                {
+                }
+
+                /**
+                 * @brief Child key getter method
+                 * @param path Relative '/' separated path
+                 */
+                StreamKey child(const std::string &path) const
+                {
+                    StreamKey key(*this);
+                    key.append(path);
+                    return key;
+                }
+
+                /**
+                 * @brief Child key operator, key / "worker3" equals key.child("worker3")
+                 * @param path Relative '/' separated path
+                 */
+                StreamKey operator/(const std::string &path) const
+                {
+                    return child(path);
+                }
+
+                /**
+                 * @brief Normalized path getter method (no leading, trailing or repeated '/')
+                 */
+                const std::string &getPath() const
+                {
+                    return m_path;
+                }
+
+                /**
+                 * @brief Path hash getter method
+                 */
+                std::uint64_t getHash() const
+                {
+                    return m_hash;
+                }
+
+                /**
+                 * @brief Local seed of the stream under a global seed
+                 * @param globalSeed Global random seed
+                 */
+                std::uint_fast64_t deriveSeed(std::uint_fast64_t globalSeed) const
+                {
+                    return navis::engine::splitMix64(navis::engine::splitMix64(globalSeed) ^ (m_hash + navis::engine::GOLDEN_GAMMA));
+                }
+
+                /**
+                 * @brief Comparison operators, keys with the same normalized path are equal
+                 */
+                bool operator==(const StreamKey &other) const
+                {
+                    return m_hash == other.m_hash && m_path == other.m_path;
+                }
+
+                bool operator!=(const StreamKey &other) const
+                {
+                    return !(*this == other);
+                }
+
+        }; // class StreamKey
+
+    } // namespace base
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_BASE_STREAMKEY_H_
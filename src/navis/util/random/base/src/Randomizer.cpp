@@ -15,7 +15,9 @@
 
 #include "navis/util/random/base/Randomizer.h"
 
+#include <atomic>
 #include <chrono>
+#include <cmath>
 #include <mutex>
 #include <limits>
 
@@ -26,12 +28,19 @@ namespace
         // "SeedGenerator" members
         private:
 
-            bool m_isSeedGenerated {false};
-            std::uint_fast64_t m_initialSeed;
+            std::atomic<bool> m_isSeedGenerated {false};
+            std::atomic<std::uint_fast64_t> m_initialSeed;
+            std::atomic<std::uint64_t> m_key;
 
-            std::mutex m_generatorMutex;
-            std::ranlux24_base m_generator;
-            std::uniform_int_distribution<> m_uniformDist;
+            std::mutex m_setterMutex;
+
+            /**
+             * @brief Seed request counters, kept on their own cache line
+             *        m_inFlight counts requests inside getNextSeed(), m_contended the requests that found another one in flight
+             */
+            alignas(64) std::atomic<std::uint64_t> m_counter {0};
+            std::atomic<std::uint32_t> m_inFlight {0};
+            std::atomic<std::uint64_t> m_contended {0};
 
         // "SeedGenerator" methods
         public:
@@ -42,34 +51,34 @@ namespace
             SeedGenerator()
               : m_initialSeed(std::chrono::duration_cast<std::chrono::microseconds>(
                                 std::chrono::high_resolution_clock::now().time_since_epoch()).count())
-              , m_generator(m_initialSeed)
-              , m_uniformDist(1, std::numeric_limits<int>::max())
+              , m_key(m_initialSeed.load())
             {    
             }
 
             /**
              * @brief Global random seed setter method
-             *        Thread-safe operation method by mutex lock
+             *        Setters are serialized by mutex lock, seed requests never take it
              */
             void setSeed(std::uint_fast64_t seed)
             {
-                std::lock_guard<std::mutex> syncLock(m_generatorMutex);
+                std::lock_guard<std::mutex> syncLock(m_setterMutex);
+                bool isSeedGenerated = m_isSeedGenerated.load(std::memory_order_acquire);
 
                 if(seed > 0)
                 {
-                    if(m_isSeedGenerated)
+                    if(isSeedGenerated)
                     {
                         // @TODO WARNING MESSEGE "[SeedGenerator]: Random number generation already started. Changing seed now will not lead to deterministic sampling."
                     }
                     else
                     {
-                        m_initialSeed = seed;
+                        m_initialSeed.store(seed, std::memory_order_relaxed);
                     }
                 }
 
                 else
                 {
-                    if(m_isSeedGenerated)
+                    if(isSeedGenerated)
                     {
                         // @TODO WARNING MESSEGE "[SeedGenerator]: Random generator seed cannot be 0. Seed has been igonored."
                         return;
@@ -78,28 +87,72 @@ namespace
                     seed = 1;
                 }
 
-                m_generator.seed(seed);
+                m_key.store(seed, std::memory_order_relaxed);
+                m_contended.store(0, std::memory_order_relaxed);
+                m_counter.store(0, std::memory_order_release);
             }
 
             /**
              * @brief Global random seed getter method
-             *        Thread-safe operation method by mutex lock
              */
             std::uint_fast64_t getInitialSeed()
             {
-                std::lock_guard<std::mutex> syncLock(m_generatorMutex);
-                return m_initialSeed;
+                return m_initialSeed.load(std::memory_order_relaxed);
             }
 
             /**
-             * @brief Global random seed getter method
-             *        Thread-safe operation method by mutex lock
+             * @brief Next local seed getter method
+             *        Lock-free : the N-th request returns splitmix64(key + N * gamma),
+             *        so seeds are distinct for 2^64 requests and only depend on the global seed and N
              */
             std::uint_fast64_t getNextSeed()
             {
-                std::lock_guard<std::mutex> syncLock(m_generatorMutex);
-                m_isSeedGenerated = true;
-                return m_uniformDist(m_generator);
+                if(!m_isSeedGenerated.load(std::memory_order_relaxed))
+                {
+                    m_isSeedGenerated.store(true, std::memory_order_release);
+                }
+
+                if(m_inFlight.fetch_add(1, std::memory_order_relaxed) > 0)
+                {
+                    m_contended.fetch_add(1, std::memory_order_relaxed);
+                }
+                const std::uint64_t index = m_counter.fetch_add(1, std::memory_order_relaxed);
+                m_inFlight.fetch_sub(1, std::memory_order_relaxed);
+
+                return navis::engine::splitMix64(m_key.load(std::memory_order_relaxed) + (index + 1) * navis::engine::GOLDEN_GAMMA);
+            }
+
+            /**
+             * @brief Named stream seed getter method
+             *        Lock-free and order independent : only reads the global seed, the request counter is untouched
+             * @param key Hierarchical stream key
+             */
+            std::uint_fast64_t deriveSeed(const navis::base::StreamKey &key)
+            {
+                if(!m_isSeedGenerated.load(std::memory_order_relaxed))
+                {
+                    m_isSeedGenerated.store(true, std::memory_order_release);
+                }
+
+                return key.deriveSeed(m_key.load(std::memory_order_relaxed));
+            }
+
+            /**
+             * @brief Seed request statistics getter method
+             * @param seedBits Number of seed bits used by the engine
+             */
+            navis::base::SeedStatistics getStatistics(int seedBits)
+            {
+                navis::base::SeedStatistics statistics;
+                statistics.issuedSeeds       = m_counter.load(std::memory_order_relaxed);
+                statistics.contendedRequests = m_contended.load(std::memory_order_relaxed);
+
+                // Birthday estimate over the seed bits actually consumed by the engine, nothing is compared
+                double seedSpace = std::ldexp(1.0, seedBits);
+                double issued    = static_cast<double>(statistics.issuedSeeds);
+                statistics.estimatedCollisions = issued * (issued - 1.0) / (2.0 * seedSpace);
+
+                return statistics;
             }
 
     }; // class SeedGenerator
@@ -133,67 +186,160 @@ namespace
 } // namespace
 
 /**
- * @brief Class constructor
- * @param NONE Always sets a different random seed
+ * @brief Global random seed setter method
+ * @param globalSeed Global random seed
  */
-navis::base::Randomizer::Randomizer()
-  : m_localSeed(getSeedGenerator().getNextSeed())
-  , m_generator(m_localSeed)
+void navis::base::GlobalSeed::set(std::uint_fast64_t globalSeed)
 {
-    // @TODO add shpere data
+    getSeedGenerator().setSeed(globalSeed);
 }
 
 /**
- * @brief Class constructor
- * @param localSeed Set to the specified instance seed
+ * @brief Global random seed getter method
  */
-navis::base::Randomizer::Randomizer(std::uint_fast64_t localSeed)
-  : m_localSeed(localSeed)
-  , m_generator(m_localSeed)
+std::uint_fast64_t navis::base::GlobalSeed::get()
 {
-    // @TODO add shpere data
+    return getSeedGenerator().getInitialSeed();
 }
 
 /**
- * @brief Class destructor
- * @param localSeed Set to the specified instance seed
+ * @brief Next local seed getter method, lock-free
  */
-navis::base::Randomizer::~Randomizer()
+std::uint_fast64_t navis::base::GlobalSeed::next()
 {
+    return getSeedGenerator().getNextSeed();
 }
 
 /**
- * @brief Global random seed setter method
- * @param gloabalSeed Global random seed that is global variable
+ * @brief Local seed of a named stream, lock-free and independent of the request order
+ * @param key Hierarchical stream key
  */
-void navis::base::Randomizer::setGlobalSeed(std::uint_fast64_t globalSeed)
+std::uint_fast64_t navis::base::GlobalSeed::derive(const StreamKey &key)
 {
-    getSeedGenerator().setSeed(globalSeed);
+    return getSeedGenerator().deriveSeed(key);
 }
 
 /**
- * @brief Global random seed getter method
+ * @brief Seed generator statistics getter method
+ * @param seedBits Number of seed bits used by the engine
  */
-std::uint_fast64_t navis::base::Randomizer::getGlobalSeed()
+navis::base::SeedStatistics navis::base::GlobalSeed::getStatistics(int seedBits)
 {
-    return getSeedGenerator().getInitialSeed();
+    return getSeedGenerator().getStatistics(seedBits);
 }
 
+namespace
+{
+    /**
+     * @brief Snapshot magic, "NAVISRNG" read as a little-endian word
+     */
+    constexpr std::uint64_t STATE_MAGIC = 0x474E52534956414EULL;
+
+    /**
+     * @brief Little-endian snapshot field writer
+     * @param bytes Output bytes
+     * @param word Field value
+     * @param size Field size in bytes
+     */
+    void writeWord(std::vector<std::uint8_t> &bytes, std::uint64_t word, int size = 8)
+    {
+        for(int index = 0; index < size; ++index)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(word >> (8 * index)));
+        }
+    }
+
+    /**
+     * @brief Little-endian snapshot field reader
+     * @param bytes Input cursor, advanced past the field
+     * @param size Remaining bytes, decreased by the field size
+     * @param word Field value
+     * @param wordSize Field size in bytes
+     * @return False when fewer than wordSize bytes remain
+     */
+    bool readWord(const std::uint8_t *&bytes, std::size_t &size, std::uint64_t &word, std::size_t wordSize = 8)
+    {
+        if(size < wordSize)
+        {
+            return false;
+        }
+
+        word = 0;
+        for(std::size_t index = 0; index < wordSize; ++index)
+        {
+            word |= static_cast<std::uint64_t>(bytes[index]) << (8 * index);
+        }
+        bytes += wordSize;
+        size  -= wordSize;
+        return true;
+    }
+
+} // namespace
+
 /**
- * @brief Local random seed setter method and reset distribution
- * @param localSeed Local random seed
- * @details Derivated class must add distribution resert function
+ * @brief Snapshot encoding method
+ * @param state Randomizer snapshot
  */
-void navis::base::Randomizer::setLocalSeed(std::uint_fast64_t localSeed)
+std::vector<std::uint8_t> navis::base::StateArchive::encode(const RandomizerState &state)
 {
-    m_localSeed = localSeed;
-    m_generator.seed(m_localSeed);
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(56 + 8 * state.engineState.size() + state.distributionState.size());
+
+    writeWord(bytes, STATE_MAGIC);
+    writeWord(bytes, VERSION, 4);
+    writeWord(bytes, state.engineType, 4);
+    writeWord(bytes, state.localSeed);
+    writeWord(bytes, state.stream);
+
+    writeWord(bytes, state.engineState.size());
+    for(std::uint64_t word : state.engineState)
+    {
+        writeWord(bytes, word);
+    }
+
+    writeWord(bytes, state.distributionState.size());
+    bytes.insert(bytes.end(), state.distributionState.begin(), state.distributionState.end());
+    return bytes;
 }
 
 /**
- * @brief Local random seed getting method
+ * @brief Snapshot decoding method
+ * @param bytes Encoded snapshot
+ * @param size Number of bytes
+ * @param state Decoded snapshot
+ * @return False when the bytes are truncated or not a snapshot of this format version
  */
-std::uint_fast64_t navis::base::Randomizer::getLocalSeed()
+bool navis::base::StateArchive::decode(const std::uint8_t *bytes, std::size_t size, RandomizerState &state)
 {
-    return m_localSeed;
+    std::uint64_t magic, version, engineType, localSeed, stream, count;
+    if(!readWord(bytes, size, magic) || magic != STATE_MAGIC ||
+       !readWord(bytes, size, version, 4) || version != VERSION ||
+       !readWord(bytes, size, engineType, 4) ||
+       !readWord(bytes, size, localSeed) ||
+       !readWord(bytes, size, stream) ||
+       !readWord(bytes, size, count) || count > size / 8)
+    {
+        return false;
+    }
+
+    state.engineType = static_cast<std::uint32_t>(engineType);
+    state.localSeed  = localSeed;
+    state.stream     = stream;
+    state.engineState.resize(count);
+    for(std::uint64_t &word : state.engineState)
+    {
+        readWord(bytes, size, word);
+    }
+
+    if(!readWord(bytes, size, count) || count != size)
+    {
+        return false;
+    }
+    state.distributionState.assign(reinterpret_cast<const char *>(bytes), size);
+    return true;
 }
+
+/**
+ * @brief Explicit instantiation of the default engine randomizer
+ */
+template class navis::base::BasicRandomizer<navis::base::DefaultEngine>;
@@ -0,0 +1,283 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    AliasTable.h
+ * @brief   Alias Table Discrete Distribution Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_DISTRIBUTION_ALIASTABLE_H_
+#define NAVIS_UTIL_RANDOM_DISTRIBUTION_ALIASTABLE_H_
+
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace navis
+{
+    namespace distribution
+    {
+        /**
+         * @brief   navis::distribution::AliasTable
+         * @details Weighted discrete sampler by the alias method (Walker, 1977, with Vose's O(n) construction)
+         *          One 64-bit word per draw : the low half picks a column by multiply-shift,
+         *          the high half is compared against the column threshold to choose between the column and its alias.
+         *          Scalar and block draws consume the words in the same order and return the same indices.
+         */
+        class AliasTable
+        {
+            // "AliasTable" members
+            private:
+
+                /**
+                 * @brief Column acceptance thresholds scaled to 2^32, full columns alias themselves
+                 */
+                std::vector<std::uint32_t> m_thresholds;
+                std::vector<std::uint32_t> m_aliases;
+
+                /**
+                 * @brief Construction work lists, kept to avoid allocation on rebuild
+                 */
+                std::vector<double> m_scaled;
+                std::vector<std::uint32_t> m_small;
+                std::vector<std::uint32_t> m_large;
+
+                double m_totalWeight {0.0};
+
+            // "AliasTable" methods
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param NONE Empty table, build before drawing
+                 * @param weights Non-negative weights (size elements, not all zero)
+                 * @param size Number of weights
+                 */
+                AliasTable() = default;
+                AliasTable(const double *weights, std::size_t size);
+
+                /**
+                 * @brief Table construction method, O(size)
+                 * @param weights Non-negative weights (size elements)
+                 * @param size Number of weights
+                 * @return False when the weights sum to zero, the table is left empty
+                 */
+                bool build(const double *weights, std::size_t size);
+
+                /**
+                 * @brief Number of outcomes getter method
+                 */
+                std::size_t size() const
+                {
+                    return m_thresholds.size();
+                }
+
+                /**
+                 * @brief Sum of the weights getter method
+                 */
+                double getTotalWeight() const
+                {
+                    return m_totalWeight;
+                }
+
+                /**
+                 * @brief Probability of an outcome reconstructed from the table
+                 * @param index Outcome index
+                 */
+                double getProbability(std::size_t index) const;
+
+                /**
+                 * @brief Index of a draw word, lets composite samplers draw their words in blocks
+                 * @param word Random word, low half column and high half coin
+                 */
+                std::size_t select(std::uint64_t word) const
+                {
+                    std::uint32_t column = static_cast<std::uint32_t>((static_cast<std::uint64_t>(static_cast<std::uint32_t>(word)) * m_thresholds.size()) >> 32);
+                    return (static_cast<std::uint32_t>(word >> 32) < m_thresholds[column]) ? column : m_aliases[column];
+                }
+
+                /**
+                 * @brief Index generation operator, O(1)
+                 * @param generator Random number engine
+                 */
+                template <typename Engine>
+                std::size_t operator()(Engine &generator) const;
+
+                /**
+                 * @brief Block index generation method
+                 * @param generator Random number engine
+                 * @param indices Caller-provided output buffer
+                 * @param size Number of indices to generate
+                 */
+                template <typename Engine>
+                void fill(Engine &generator, std::size_t *indices, std::size_t size) const;
+
+        }; // class AliasTable
+
+        /**
+         * @brief   navis::distribution::DynamicAliasTable
+         * @details Two-level alias table for weights that change a few at a time
+         *          Weights are grouped in fixed size blocks, each with its own table, and a top table over the block sums.
+         *          A weight update only marks its block, rebuild() then costs O(block size) per dirty block plus O(number of blocks).
+         */
+        class DynamicAliasTable
+        {
+            // "DynamicAliasTable" members
+            private:
+
+                std::size_t m_blockSize;
+                std::vector<double> m_weights;
+                std::vector<double> m_blockWeights;
+                std::vector<AliasTable> m_blocks;
+                AliasTable m_top;
+                std::vector<std::size_t> m_dirtyBlocks;
+                std::vector<bool> m_isDirty;
+
+            // "DynamicAliasTable" methods
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param weights Non-negative weights (size elements, not all zero)
+                 * @param size Number of weights
+                 * @param blockSize Number of weights per block (default : 64)
+                 */
+                DynamicAliasTable(const double *weights, std::size_t size, std::size_t blockSize = 64);
+
+                /**
+                 * @brief Number of outcomes getter method
+                 */
+                std::size_t size() const
+                {
+                    return m_weights.size();
+                }
+
+                /**
+                 * @brief Weight getter method
+                 * @param index Outcome index
+                 */
+                double getWeight(std::size_t index) const
+                {
+                    return m_weights[index];
+                }
+
+                /**
+                 * @brief Weight setter method, takes effect on the next rebuild()
+                 * @param index Outcome index
+                 * @param weight Non-negative weight
+                 */
+                void setWeight(std::size_t index, double weight);
+
+                /**
+                 * @brief Whether weight updates are pending
+                 */
+                bool isDirty() const
+                {
+                    return !m_dirtyBlocks.empty();
+                }
+
+                /**
+                 * @brief Rebuild the dirty blocks and the top table
+                 * @return False when all weights are zero, the table must not be drawn from until weights are set
+                 */
+                bool rebuild();
+
+                /**
+                 * @brief Index generation operator, O(1)
+                 * @param generator Random number engine
+                 */
+                template <typename Engine>
+                std::size_t operator()(Engine &generator) const;
+
+                /**
+                 * @brief Block index generation method
+                 * @param generator Random number engine
+                 * @param indices Caller-provided output buffer
+                 * @param size Number of indices to generate
+                 */
+                template <typename Engine>
+                void fill(Engine &generator, std::size_t *indices, std::size_t size) const;
+
+        }; // class DynamicAliasTable
+
+        /**
+         * @brief Index generation operator, O(1)
+         * @param generator Random number engine
+         */
+        template <typename Engine>
+        inline std::size_t AliasTable::operator()(Engine &generator) const
+        {
+            assert(!m_thresholds.empty());
+            return select(navis::engine::EngineTraits<Engine>::next64(generator));
+        }
+
+        /**
+         * @brief Block index generation method
+         * @param generator Random number engine
+         * @param indices Caller-provided output buffer
+         * @param size Number of indices to generate
+         */
+        template <typename Engine>
+        void AliasTable::fill(Engine &generator, std::size_t *indices, std::size_t size) const
+        {
+            assert(!m_thresholds.empty());
+            constexpr std::size_t blockSize = 256;
+            std::uint32_t words[2 * blockSize];
+
+            while(size > 0)
+            {
+                std::size_t count = (size < blockSize) ? size : blockSize;
+                navis::engine::EngineTraits<Engine>::generateWords(generator, words, 2 * count);
+
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    indices[index] = select(words[2 * index] | (static_cast<std::uint64_t>(words[2 * index + 1]) << 32));
+                }
+
+                indices += count;
+                size    -= count;
+            }
+        }
+
+        /**
+         * @brief Index generation operator, O(1)
+         * @param generator Random number engine
+         */
+        template <typename Engine>
+        inline std::size_t DynamicAliasTable::operator()(Engine &generator) const
+        {
+            assert(!isDirty());
+            std::size_t block = m_top(generator);
+            return block * m_blockSize + m_blocks[block](generator);
+        }
+
+        /**
+         * @brief Block index generation method
+         * @param generator Random number engine
+         * @param indices Caller-provided output buffer
+         * @param size Number of indices to generate
+         */
+        template <typename Engine>
+        void DynamicAliasTable::fill(Engine &generator, std::size_t *indices, std::size_t size) const
+        {
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                indices[index] = (*this)(generator);
+            }
+        }
+
+    } // namespace distribution
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_DISTRIBUTION_ALIASTABLE_H_
@@ -0,0 +1,96 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    BoundedInteger.h
+ * @brief   Bounded Integer Distribution Function Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_DISTRIBUTION_BOUNDEDINTEGER_H_
+#define NAVIS_UTIL_RANDOM_DISTRIBUTION_BOUNDEDINTEGER_H_
+
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace navis
+{
+    namespace distribution
+    {
+        /**
+         * @brief Rejection threshold of the 32-bit multiply-shift, (2^32 - range) mod range
+         *        A word w is accepted when the low half of w * range is not below it
+         * @param range Number of outcomes (non-zero)
+         */
+        inline std::uint32_t boundedThreshold32(std::uint32_t range)
+        {
+            return static_cast<std::uint32_t>(-range) % range;
+        }
+
+        /**
+         * @brief Unbiased integer in [0, range) by multiply-shift with rejection (Lemire, 2019)
+         *        The high half of word * range is the result, the low half decides the rare rejection.
+         *        The threshold (2^32 - range) mod range is only computed on the slow path.
+         * @param generator Random number engine
+         * @param range Number of outcomes, 0 selects the full 32-bit range
+         */
+        template <typename Engine>
+        inline std::uint32_t boundedUInt32(Engine &generator, std::uint32_t range)
+        {
+            using Traits = navis::engine::EngineTraits<Engine>;
+            if(range == 0)
+            {
+                return Traits::next32(generator);
+            }
+
+            std::uint64_t product = static_cast<std::uint64_t>(Traits::next32(generator)) * range;
+            if(static_cast<std::uint32_t>(product) < range)
+            {
+                const std::uint32_t threshold = boundedThreshold32(range);
+                while(static_cast<std::uint32_t>(product) < threshold)
+                {
+                    product = static_cast<std::uint64_t>(Traits::next32(generator)) * range;
+                }
+            }
+            return static_cast<std::uint32_t>(product >> 32);
+        }
+
+        /**
+         * @brief Unbiased integer in [0, range) by 64x64-bit multiply-shift with rejection (Lemire, 2019)
+         * @param generator Random number engine
+         * @param range Number of outcomes, 0 selects the full 64-bit range
+         */
+        template <typename Engine>
+        inline std::uint64_t boundedUInt64(Engine &generator, std::uint64_t range)
+        {
+            using Traits = navis::engine::EngineTraits<Engine>;
+            if(range == 0)
+            {
+                return Traits::next64(generator);
+            }
+
+            unsigned __int128 product = static_cast<unsigned __int128>(Traits::next64(generator)) * range;
+            if(static_cast<std::uint64_t>(product) < range)
+            {
+                const std::uint64_t threshold = (0 - range) % range;
+                while(static_cast<std::uint64_t>(product) < threshold)
+                {
+                    product = static_cast<unsigned __int128>(Traits::next64(generator)) * range;
+                }
+            }
+            return static_cast<std::uint64_t>(product >> 64);
+        }
+
+    } // namespace distribution
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_DISTRIBUTION_BOUNDEDINTEGER_H_
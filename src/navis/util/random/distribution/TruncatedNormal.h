@@ -0,0 +1,249 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    TruncatedNormal.h
+ * @brief   Truncated Normal Distribution Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_DISTRIBUTION_TRUNCATEDNORMAL_H_
+#define NAVIS_UTIL_RANDOM_DISTRIBUTION_TRUNCATEDNORMAL_H_
+
+#include "navis/util/random/distribution/ZigguratNormal.h"
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace navis
+{
+    namespace distribution
+    {
+        /**
+         * @brief   navis::distribution::TruncatedNormal
+         * @details Exact sampler of N(mean, stdDev^2) restricted to [lowerBound, upperBound] (Robert, 1995)
+         *          The interval is standardized and mirrored to [a, b] with b > 0, then one of three proposals is fixed at construction :
+         *          - NORMAL      : a < 0 < b and b - a >= sqrt(2 PI), plain normal draws inside the interval
+         *          - UNIFORM     : short intervals, uniform proposal accepted with exp((m^2 - x^2) / 2)
+         *          - EXPONENTIAL : tail intervals, shifted exponential proposal with the optimal rate
+         *          Every regime accepts at least about half of the proposals, including intervals far in the tail.
+         */
+        class TruncatedNormal
+        {
+            public:
+
+                /**
+                 * @brief Proposal distribution of the rejection sampler
+                 */
+                enum class Method
+                {
+                    POINT,
+                    NORMAL,
+                    UNIFORM,
+                    EXPONENTIAL
+                };
+
+            // "TruncatedNormal" members
+            private:
+
+                ZigguratNormal m_normal;
+                Method m_method;
+
+                /**
+                 * @brief Standardized interval, mirrored so that upper > 0
+                 */
+                double m_lower;
+                double m_upper;
+
+                /**
+                 * @brief Squared point of the interval closest to 0 (uniform proposal)
+                 */
+                double m_minimumSquare;
+
+                /**
+                 * @brief Rate of the exponential proposal
+                 */
+                double m_rate;
+
+                /**
+                 * @brief Output transform, value = mean + scale * standardized (scale is negative when mirrored)
+                 */
+                double m_mean;
+                double m_scale;
+
+            // "TruncatedNormal" methods
+            private:
+
+                /**
+                 * @brief Real number in (0, 1] from the upper 53 bits of the word
+                 */
+                static double toOpenUnit(std::uint64_t word)
+                {
+                    return static_cast<double>((word >> 11) + 1) * 0x1.0p-53;
+                }
+
+                /**
+                 * @brief Proposal and acceptance test of one standardized candidate
+                 * @param proposal Proposal word
+                 * @param test Acceptance word
+                 * @param value Standardized candidate
+                 * @return True when the candidate is accepted
+                 */
+                bool propose(std::uint64_t proposal, std::uint64_t test, double &value) const
+                {
+                    if(m_method == Method::UNIFORM)
+                    {
+                        value = m_lower + (m_upper - m_lower) * toOpenUnit(proposal);
+                        return 2.0 * std::log(toOpenUnit(test)) <= m_minimumSquare - value * value;
+                    }
+
+                    value = m_lower - std::log(toOpenUnit(proposal)) / m_rate;
+                    const double delta = value - m_rate;
+                    return (2.0 * std::log(toOpenUnit(test)) <= -delta * delta) && (value <= m_upper);
+                }
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param lowerBound Lower boundary of the result (may be -infinity)
+                 * @param upperBound Upper boundary of the result (may be +infinity)
+                 * @param mean Mean of the untruncated gaussian distribution
+                 * @param stdDev Standard deviation of the untruncated gaussian distribution
+                 */
+                TruncatedNormal(double lowerBound, double upperBound, double mean, double stdDev);
+
+                /**
+                 * @brief Selected proposal getter method
+                 */
+                Method getMethod() const
+                {
+                    return m_method;
+                }
+
+                /**
+                 * @brief Random number generation operator
+                 * @param generator Random number engine
+                 */
+                template <typename Engine>
+                double operator()(Engine &generator) const;
+
+                /**
+                 * @brief Block generation method
+                 *        Candidates are proposed and tested a block at a time, accepted values are compacted branch-free
+                 * @param generator Random number engine
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 */
+                template <typename Engine>
+                void fill(Engine &generator, double *buffer, std::size_t size) const;
+
+        }; // class TruncatedNormal
+
+        /**
+         * @brief Random number generation operator
+         * @param generator Random number engine
+         */
+        template <typename Engine>
+        double TruncatedNormal::operator()(Engine &generator) const
+        {
+            using Traits = navis::engine::EngineTraits<Engine>;
+            double value = m_lower;
+
+            switch(m_method)
+            {
+                case Method::POINT:
+                    break;
+
+                case Method::NORMAL:
+                    do
+                    {
+                        value = m_normal(generator);
+                    }
+                    while(value < m_lower || value > m_upper);
+                    break;
+
+                default:
+                    while(true)
+                    {
+                        std::uint64_t proposal = Traits::next64(generator);
+                        if(propose(proposal, Traits::next64(generator), value))
+                        {
+                            break;
+                        }
+                    }
+                    break;
+            }
+            return m_mean + m_scale * value;
+        }
+
+        /**
+         * @brief Block generation method
+         * @param generator Random number engine
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         */
+        template <typename Engine>
+        void TruncatedNormal::fill(Engine &generator, double *buffer, std::size_t size) const
+        {
+            constexpr std::size_t blockSize = 256;
+            std::size_t written = 0;
+
+            if(m_method == Method::POINT)
+            {
+                for(; written < size; ++written)
+                {
+                    buffer[written] = m_mean + m_scale * m_lower;
+                }
+                return;
+            }
+
+            while(written < size)
+            {
+                const std::size_t count = (size - written < blockSize) ? size - written : blockSize;
+
+                // Candidates of a block are compacted into the output, the block never overruns the remaining space
+                if(m_method == Method::NORMAL)
+                {
+                    double candidates[blockSize];
+                    m_normal.fill(generator, candidates, count, 0.0, 1.0);
+
+                    for(std::size_t index = 0; index < count; ++index)
+                    {
+                        const double value = candidates[index];
+                        buffer[written] = m_mean + m_scale * value;
+                        written += static_cast<std::size_t>((value >= m_lower) & (value <= m_upper));
+                    }
+                    continue;
+                }
+
+                std::uint32_t words[4 * blockSize];
+                navis::engine::EngineTraits<Engine>::generateWords(generator, words, 4 * count);
+
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    const std::uint32_t *lane = words + 4 * index;
+                    const std::uint64_t proposal = lane[0] | (static_cast<std::uint64_t>(lane[1]) << 32);
+                    const std::uint64_t test     = lane[2] | (static_cast<std::uint64_t>(lane[3]) << 32);
+
+                    double value;
+                    const bool isAccepted = propose(proposal, test, value);
+                    buffer[written] = m_mean + m_scale * value;
+                    written += static_cast<std::size_t>(isAccepted);
+                }
+            }
+        }
+
+    } // namespace distribution
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_DISTRIBUTION_TRUNCATEDNORMAL_H_
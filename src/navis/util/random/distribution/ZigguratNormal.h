@@ -0,0 +1,267 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ZigguratNormal.h
+ * @brief   Ziggurat Normal Distribution Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_DISTRIBUTION_ZIGGURATNORMAL_H_
+#define NAVIS_UTIL_RANDOM_DISTRIBUTION_ZIGGURATNORMAL_H_
+
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace navis
+{
+    namespace distribution
+    {
+        /**
+         * @brief   navis::distribution::ZigguratNormal
+         * @details Standard normal sampler by the 256-layer ziggurat method (Marsaglia and Tsang, 2000)
+         *          One 64-bit word per draw : bits [0, 8) layer, bit 8 sign, bits [11, 64) abscissa.
+         *          About 99% of the draws are accepted by one multiply and one compare.
+         *          The block fill runs the accept test branch-free over the whole block first,
+         *          and only the rejected lanes continue with the wedge and tail tests.
+         */
+        class ZigguratNormal
+        {
+            public:
+
+                static constexpr int LAYERS = 256;
+
+                /**
+                 * @brief Ziggurat layer tables
+                 * @param x Right edge of each layer, x[0] is the base strip width and x[LAYERS] = 0
+                 * @param f Unnormalized density exp(-x^2 / 2) at each edge
+                 */
+                struct Tables
+                {
+                    double x[LAYERS + 1];
+                    double f[LAYERS + 1];
+                };
+
+                /**
+                 * @brief Start of the tail (right edge of the first rectangle)
+                 */
+                static constexpr double TAIL_START = 3.654152885361008796;
+
+            // "ZigguratNormal" members
+            private:
+
+                const Tables &m_tables;
+
+            // "ZigguratNormal" methods
+            private:
+
+                /**
+                 * @brief Real number in (0, 1] from the upper 53 bits of the word
+                 */
+                static double toOpenUnit(std::uint64_t word)
+                {
+                    return static_cast<double>((word >> 11) + 1) * 0x1.0p-53;
+                }
+
+                /**
+                 * @brief Candidate abscissa of the word in its layer
+                 */
+                double candidate(std::uint64_t word) const
+                {
+                    return static_cast<double>(word >> 11) * 0x1.0p-53 * m_tables.x[word & 0xFF];
+                }
+
+                /**
+                 * @brief Wedge and tail tests of a draw rejected by the rectangle test
+                 * @param generator Random number engine
+                 * @param word Rejected 64-bit word
+                 */
+                template <typename Engine>
+                double continueDraw(Engine &generator, std::uint64_t word) const;
+
+                /**
+                 * @brief Branch-free rectangle test over a block
+                 * @param words Random words (2 * size elements, low half first)
+                 * @param output Accepted signed values, rejected lanes are left undefined
+                 * @param rejected Indices of the rejected lanes
+                 * @param size Number of values
+                 * @return Number of rejected lanes
+                 */
+                std::size_t acceptBlock(const std::uint32_t *words, double *output, std::uint32_t *rejected, std::size_t size) const;
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 */
+                ZigguratNormal();
+
+                /**
+                 * @brief Ziggurat table getter method, built once per process
+                 */
+                static const Tables &getTables();
+
+                /**
+                 * @brief Standard normal random number generation operator
+                 * @param generator Random number engine
+                 */
+                template <typename Engine>
+                double operator()(Engine &generator) const;
+
+                /**
+                 * @brief Block generation method
+                 * @param generator Random number engine
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param mean Mean of the gaussian distribution
+                 * @param stdDev Standard deviation of the gaussian distribution
+                 */
+                template <typename Engine>
+                void fill(Engine &generator, double *buffer, std::size_t size, double mean, double stdDev) const;
+
+                /**
+                 * @brief Block generation method with per-lane parameters
+                 * @param generator Random number engine
+                 * @param buffer Caller-provided output buffer
+                 * @param size Number of values to generate
+                 * @param mean Mean of each lane (size elements)
+                 * @param stdDev Standard deviation of each lane (size elements)
+                 */
+                template <typename Engine>
+                void fill(Engine &generator, double *buffer, std::size_t size, const double *mean, const double *stdDev) const;
+
+        }; // class ZigguratNormal
+
+        /**
+         * @brief Wedge and tail tests of a draw rejected by the rectangle test
+         * @param generator Random number engine
+         * @param word Rejected 64-bit word
+         */
+        template <typename Engine>
+        double ZigguratNormal::continueDraw(Engine &generator, std::uint64_t word) const
+        {
+            using Traits = navis::engine::EngineTraits<Engine>;
+
+            for(;;)
+            {
+                const unsigned layer = word & 0xFF;
+                const double sign    = (word & 0x100) ? -1.0 : 1.0;
+                const double x       = candidate(word);
+
+                if(x < m_tables.x[layer + 1])
+                {
+                    return sign * x;
+                }
+
+                if(layer == 0)
+                {
+                    // Tail beyond TAIL_START (Marsaglia, 1964)
+                    double tail, height;
+                    do
+                    {
+                        tail   = -std::log(toOpenUnit(Traits::next64(generator))) / TAIL_START;
+                        height = -std::log(toOpenUnit(Traits::next64(generator)));
+                    }
+                    while(height + height < tail * tail);
+
+                    return sign * (TAIL_START + tail);
+                }
+
+                double height = m_tables.f[layer] + toOpenUnit(Traits::next64(generator)) * (m_tables.f[layer + 1] - m_tables.f[layer]);
+                if(height < std::exp(-0.5 * x * x))
+                {
+                    return sign * x;
+                }
+
+                word = Traits::next64(generator);
+            }
+        }
+
+        /**
+         * @brief Standard normal random number generation operator
+         * @param generator Random number engine
+         */
+        template <typename Engine>
+        inline double ZigguratNormal::operator()(Engine &generator) const
+        {
+            std::uint64_t word = navis::engine::EngineTraits<Engine>::next64(generator);
+            double x = candidate(word);
+
+            if(x < m_tables.x[(word & 0xFF) + 1])
+            {
+                return (word & 0x100) ? -x : x;
+            }
+            return continueDraw(generator, word);
+        }
+
+        /**
+         * @brief Block generation method
+         * @param generator Random number engine
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param mean Mean of the gaussian distribution
+         * @param stdDev Standard deviation of the gaussian distribution
+         */
+        template <typename Engine>
+        void ZigguratNormal::fill(Engine &generator, double *buffer, std::size_t size, double mean, double stdDev) const
+        {
+            constexpr std::size_t blockSize = 256;
+            std::uint32_t words[2 * blockSize];
+            std::uint32_t rejected[blockSize];
+
+            while(size > 0)
+            {
+                std::size_t count = (size < blockSize) ? size : blockSize;
+                navis::engine::EngineTraits<Engine>::generateWords(generator, words, 2 * count);
+
+                std::size_t rejectedCount = acceptBlock(words, buffer, rejected, count);
+                for(std::size_t index = 0; index < rejectedCount; ++index)
+                {
+                    std::uint32_t lane = rejected[index];
+                    std::uint64_t word = words[2 * lane] | (static_cast<std::uint64_t>(words[2 * lane + 1]) << 32);
+                    buffer[lane] = continueDraw(generator, word);
+                }
+
+                for(std::size_t index = 0; index < count; ++index)
+                {
+                    buffer[index] = buffer[index] * stdDev + mean;
+                }
+
+                buffer += count;
+                size   -= count;
+            }
+        }
+
+        /**
+         * @brief Block generation method with per-lane parameters
+         * @param generator Random number engine
+         * @param buffer Caller-provided output buffer
+         * @param size Number of values to generate
+         * @param mean Mean of each lane (size elements)
+         * @param stdDev Standard deviation of each lane (size elements)
+         */
+        template <typename Engine>
+        void ZigguratNormal::fill(Engine &generator, double *buffer, std::size_t size, const double *mean, const double *stdDev) const
+        {
+            fill(generator, buffer, size, 0.0, 1.0);
+
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                buffer[index] = buffer[index] * stdDev[index] + mean[index];
+            }
+        }
+
+    } // namespace distribution
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_DISTRIBUTION_ZIGGURATNORMAL_H_
@@ -0,0 +1,194 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    AliasTable.cpp
+ * @brief   Alias Table Discrete Distribution Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/distribution/AliasTable.h"
+
+#include <algorithm>
+
+namespace
+{
+    /**
+     * @brief Acceptance probability scaled to a 32-bit threshold
+     */
+    std::uint32_t toThreshold(double probability)
+    {
+        double scaled = probability * 4294967296.0;
+        if(scaled <= 0.0)
+        {
+            return 0;
+        }
+        return (scaled >= 4294967295.0) ? 0xFFFFFFFFu : static_cast<std::uint32_t>(scaled);
+    }
+
+} // namespace
+
+/**
+ * @brief Class constructor
+ * @param weights Non-negative weights (size elements, not all zero)
+ * @param size Number of weights
+ */
+navis::distribution::AliasTable::AliasTable(const double *weights, std::size_t size)
+{
+    build(weights, size);
+}
+
+/**
+ * @brief Table construction method, O(size)
+ * @param weights Non-negative weights (size elements)
+ * @param size Number of weights
+ * @return False when the weights sum to zero, the table is left empty
+ */
+bool navis::distribution::AliasTable::build(const double *weights, std::size_t size)
+{
+    assert(size <= 0xFFFFFFFFULL);
+
+    double total = 0.0;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        assert(weights[index] >= 0.0);
+        total += weights[index];
+    }
+
+    m_totalWeight = total;
+    if(!(total > 0.0))
+    {
+        m_thresholds.clear();
+        m_aliases.clear();
+        return false;
+    }
+
+    m_thresholds.resize(size);
+    m_aliases.resize(size);
+    m_scaled.resize(size);
+    m_small.clear();
+    m_large.clear();
+
+    // Vose : pair every under-full column with an over-full one, the donor keeps the remainder
+    const double scale = static_cast<double>(size) / total;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        m_scaled[index] = weights[index] * scale;
+        (m_scaled[index] < 1.0 ? m_small : m_large).push_back(static_cast<std::uint32_t>(index));
+    }
+
+    while(!m_small.empty() && !m_large.empty())
+    {
+        std::uint32_t small = m_small.back();
+        std::uint32_t large = m_large.back();
+        m_small.pop_back();
+
+        m_thresholds[small] = toThreshold(m_scaled[small]);
+        m_aliases[small] = large;
+
+        m_scaled[large] = (m_scaled[large] + m_scaled[small]) - 1.0;
+        if(m_scaled[large] < 1.0)
+        {
+            m_large.pop_back();
+            m_small.push_back(large);
+        }
+    }
+
+    // Leftovers are full up to rounding : they alias themselves so the threshold does not matter
+    for(auto list : {&m_small, &m_large})
+    {
+        for(std::uint32_t index : *list)
+        {
+            m_thresholds[index] = 0xFFFFFFFFu;
+            m_aliases[index] = index;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Probability of an outcome reconstructed from the table
+ * @param index Outcome index
+ */
+double navis::distribution::AliasTable::getProbability(std::size_t index) const
+{
+    double probability = 0.0;
+    for(std::size_t column = 0; column < m_thresholds.size(); ++column)
+    {
+        double accept = (m_aliases[column] == column) ? 1.0 : m_thresholds[column] * 0x1.0p-32;
+        if(column == index)
+        {
+            probability += accept;
+        }
+        else if(m_aliases[column] == index)
+        {
+            probability += 1.0 - accept;
+        }
+    }
+    return m_thresholds.empty() ? 0.0 : probability / static_cast<double>(m_thresholds.size());
+}
+
+/**
+ * @brief Class constructor
+ * @param weights Non-negative weights (size elements, not all zero)
+ * @param size Number of weights
+ * @param blockSize Number of weights per block (default : 64)
+ */
+navis::distribution::DynamicAliasTable::DynamicAliasTable(const double *weights, std::size_t size, std::size_t blockSize)
+  : m_blockSize(blockSize)
+  , m_weights(weights, weights + size)
+  , m_blockWeights((size + blockSize - 1) / blockSize, 0.0)
+  , m_blocks(m_blockWeights.size())
+  , m_isDirty(m_blockWeights.size(), true)
+{
+    assert(blockSize > 0);
+    for(std::size_t block = 0; block < m_blocks.size(); ++block)
+    {
+        m_dirtyBlocks.push_back(block);
+    }
+    rebuild();
+}
+
+/**
+ * @brief Weight setter method, takes effect on the next rebuild()
+ * @param index Outcome index
+ * @param weight Non-negative weight
+ */
+void navis::distribution::DynamicAliasTable::setWeight(std::size_t index, double weight)
+{
+    assert(weight >= 0.0);
+    m_weights[index] = weight;
+
+    std::size_t block = index / m_blockSize;
+    if(!m_isDirty[block])
+    {
+        m_isDirty[block] = true;
+        m_dirtyBlocks.push_back(block);
+    }
+}
+
+/**
+ * @brief Rebuild the dirty blocks and the top table
+ * @return False when all weights are zero, the table must not be drawn from until weights are set
+ */
+bool navis::distribution::DynamicAliasTable::rebuild()
+{
+    for(std::size_t block : m_dirtyBlocks)
+    {
+        std::size_t first = block * m_blockSize;
+        std::size_t count = std::min(m_blockSize, m_weights.size() - first);
+
+        m_blocks[block].build(m_weights.data() + first, count);
+        m_blockWeights[block] = m_blocks[block].getTotalWeight();
+        m_isDirty[block] = false;
+    }
+    m_dirtyBlocks.clear();
+
+    return m_top.build(m_blockWeights.data(), m_blockWeights.size());
+}
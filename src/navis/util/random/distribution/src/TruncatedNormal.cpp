@@ -0,0 +1,64 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    TruncatedNormal.cpp
+ * @brief   Truncated Normal Distribution Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/distribution/TruncatedNormal.h"
+
+#include <cassert>
+
+/**
+ * @brief Class constructor
+ * @param lowerBound Lower boundary of the result (may be -infinity)
+ * @param upperBound Upper boundary of the result (may be +infinity)
+ * @param mean Mean of the untruncated gaussian distribution
+ * @param stdDev Standard deviation of the untruncated gaussian distribution
+ */
+navis::distribution::TruncatedNormal::TruncatedNormal(double lowerBound, double upperBound, double mean, double stdDev)
+  : m_method(Method::POINT)
+  , m_minimumSquare(0.0)
+  , m_rate(0.0)
+  , m_mean(mean)
+  , m_scale(stdDev)
+{
+    assert(lowerBound <= upperBound && stdDev > 0.0);
+
+    const double alpha = (lowerBound - mean) / stdDev;
+    const double beta  = (upperBound - mean) / stdDev;
+
+    // Mirror intervals on the negative side so that the upper bound is positive
+    const bool isMirrored = (beta <= 0.0);
+    m_lower = isMirrored ? -beta : alpha;
+    m_upper = isMirrored ? -alpha : beta;
+    m_scale = isMirrored ? -stdDev : stdDev;
+
+    if(lowerBound == upperBound)
+    {
+        m_method = Method::POINT;
+    }
+    else if(m_lower < 0.0)
+    {
+        // Interval around the mean : normal proposal unless it is short
+        m_method = (m_upper - m_lower >= std::sqrt(2.0 * M_PI)) ? Method::NORMAL : Method::UNIFORM;
+    }
+    else
+    {
+        // Tail interval : Robert's optimal exponential rate, uniform proposal when the interval is short enough
+        const double root = std::sqrt(m_lower * m_lower + 4.0);
+        m_rate = 0.5 * (m_lower + root);
+
+        const double uniformLimit = 2.0 * std::sqrt(M_E) / (m_lower + root) * std::exp(0.25 * (m_lower * m_lower - m_lower * root));
+        m_method = (m_upper - m_lower < uniformLimit) ? Method::UNIFORM : Method::EXPONENTIAL;
+        m_minimumSquare = m_lower * m_lower;
+    }
+}
@@ -0,0 +1,95 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ZigguratNormal.cpp
+ * @brief   Ziggurat Normal Distribution Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/distribution/ZigguratNormal.h"
+
+namespace
+{
+    /**
+     * @brief Ziggurat table construction function
+     *        Every layer has the same area V = R f(R) + integral of f over [R, inf)
+     */
+    navis::distribution::ZigguratNormal::Tables buildTables()
+    {
+        using navis::distribution::ZigguratNormal;
+        constexpr int layers = ZigguratNormal::LAYERS;
+        const double tailStart = ZigguratNormal::TAIL_START;
+
+        ZigguratNormal::Tables tables;
+        const double tailDensity = std::exp(-0.5 * tailStart * tailStart);
+        const double area = tailStart * tailDensity + std::sqrt(M_PI / 2.0) * std::erfc(tailStart / std::sqrt(2.0));
+
+        tables.x[0] = area / tailDensity;
+        tables.x[1] = tailStart;
+
+        for(int layer = 1; layer < layers - 1; ++layer)
+        {
+            double density = std::exp(-0.5 * tables.x[layer] * tables.x[layer]);
+            tables.x[layer + 1] = std::sqrt(-2.0 * std::log(area / tables.x[layer] + density));
+        }
+        tables.x[layers] = 0.0;
+
+        for(int layer = 0; layer <= layers; ++layer)
+        {
+            tables.f[layer] = std::exp(-0.5 * tables.x[layer] * tables.x[layer]);
+        }
+        return tables;
+    }
+
+} // namespace
+
+/**
+ * @brief Class constructor
+ */
+navis::distribution::ZigguratNormal::ZigguratNormal()
+  : m_tables(getTables())
+{
+}
+
+/**
+ * @brief Ziggurat table getter method, built once per process
+ */
+const navis::distribution::ZigguratNormal::Tables &navis::distribution::ZigguratNormal::getTables()
+{
+    static const Tables tables = buildTables();
+    return tables;
+}
+
+/**
+ * @brief Branch-free rectangle test over a block
+ * @param words Random words (2 * size elements, low half first)
+ * @param output Accepted signed values, rejected lanes are left undefined
+ * @param rejected Indices of the rejected lanes
+ * @param size Number of values
+ * @return Number of rejected lanes
+ */
+std::size_t navis::distribution::ZigguratNormal::acceptBlock(const std::uint32_t *words, double *output, std::uint32_t *rejected, std::size_t size) const
+{
+    std::size_t rejectedCount = 0;
+
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        std::uint64_t word = words[2 * index] | (static_cast<std::uint64_t>(words[2 * index + 1]) << 32);
+        unsigned layer = word & 0xFF;
+
+        double x = candidate(word);
+        double sign = 1.0 - static_cast<double>((word >> 7) & 0x2);
+
+        output[index] = sign * x;
+        rejected[rejectedCount] = static_cast<std::uint32_t>(index);
+        rejectedCount += (x >= m_tables.x[layer + 1]);
+    }
+    return rejectedCount;
+}
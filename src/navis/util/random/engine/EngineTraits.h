@@ -0,0 +1,524 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    EngineTraits.h
+ * @brief   Random Number Engine Traits Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_ENGINE_ENGINETRAITS_H_
+#define NAVIS_UTIL_RANDOM_ENGINE_ENGINETRAITS_H_
+
+#include "navis/util/random/engine/PhiloxEngine.h"
+#include "navis/util/random/engine/PrefetchingEngine.h"
+#include "navis/util/random/engine/Pcg64Engine.h"
+#include "navis/util/random/engine/Xoshiro256Engine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+namespace navis
+{
+    namespace engine
+    {
+        /**
+         * @brief splitmix64 output function, bijective on 64-bit words
+         * @param state Weyl sequence state
+         */
+        inline std::uint64_t splitMix64(std::uint64_t state)
+        {
+            state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            state = (state ^ (state >> 27)) * 0x94D049BB133111EBULL;
+            return state ^ (state >> 31);
+        }
+
+        /**
+         * @brief Weyl sequence increment of splitmix64
+         */
+        constexpr std::uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ULL;
+
+        /**
+         * @brief   navis::engine::SplitMixSeedSequence
+         * @details Seed sequence expanding a 64-bit seed and a stream identifier into engine state words with splitmix64
+         *          Satisfies the generate() part of the standard seed sequence requirements, which is all the standard
+         *          engines use. One splitmix64 call yields two state words, so seeding costs about as much as
+         *          the scalar Engine(seed) constructor, unlike std::seed_seq which mixes every word several times.
+         */
+        class SplitMixSeedSequence
+        {
+            // "SplitMixSeedSequence" members
+            private:
+
+                std::uint64_t m_key;
+
+            // "SplitMixSeedSequence" methods
+            public:
+
+                using result_type = std::uint32_t;
+
+                /**
+                 * @brief Class constructor
+                 * @param localSeed Local random seed
+                 * @param streamId Stream identifier
+                 */
+                SplitMixSeedSequence(std::uint64_t localSeed, std::uint64_t streamId)
+                  : m_key(splitMix64(splitMix64(localSeed) ^ streamId))
+                {
+                }
+
+                /**
+                 * @brief Fill the range with 32-bit state words
+                 * @param begin First output word
+                 * @param end Past the last output word
+                 */
+                template <typename Iterator>
+                void generate(Iterator begin, Iterator end) const
+                {
+                    std::uint64_t counter = m_key;
+                    while(begin != end)
+                    {
+                        counter += GOLDEN_GAMMA;
+                        const std::uint64_t word = splitMix64(counter);
+                        *begin++ = static_cast<result_type>(word);
+                        if(begin != end)
+                        {
+                            *begin++ = static_cast<result_type>(word >> 32);
+                        }
+                    }
+                }
+        };
+
+        /**
+         * @brief Engine state capture function, appends the state as 64-bit words
+         *        Standard engines are captured through their textual representation, which is a sequence of integers
+         * @param generator Random number engine
+         * @param words Output state words
+         */
+        template <typename Engine>
+        void saveEngineState(const Engine &generator, std::vector<std::uint64_t> &words)
+        {
+            std::ostringstream output;
+            output << generator;
+
+            std::istringstream input(output.str());
+            unsigned long long word;
+            while(input >> word)
+            {
+                words.push_back(word);
+            }
+        }
+
+        inline void saveEngineState(const Xoshiro256Engine &generator, std::vector<std::uint64_t> &words)
+        {
+            const Xoshiro256Engine::StateType &state = generator.getState();
+            words.insert(words.end(), state.begin(), state.end());
+        }
+
+        /**
+         * @brief Engine state restore function
+         * @param generator Random number engine, unchanged on failure
+         * @param words State words written by saveEngineState()
+         * @param size Number of state words
+         * @return False when the words are not a valid state of the engine
+         */
+        template <typename Engine>
+        bool loadEngineState(Engine &generator, const std::uint64_t *words, std::size_t size)
+        {
+            std::ostringstream output;
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                output << words[index] << ' ';
+            }
+
+            Engine restored;
+            std::istringstream input(output.str());
+            input >> restored;
+            if(input.fail())
+            {
+                return false;
+            }
+            generator = restored;
+            return true;
+        }
+
+        inline bool loadEngineState(Xoshiro256Engine &generator, const std::uint64_t *words, std::size_t size)
+        {
+            if(size != 4 || (words[0] | words[1] | words[2] | words[3]) == 0)
+            {
+                return false;
+            }
+            generator.setState({words[0], words[1], words[2], words[3]});
+            return true;
+        }
+
+        /**
+         * @brief Engine type identifier written into randomizer snapshots
+         *        Engines without an identifier (0) can be saved but their snapshots are never restored
+         */
+        template <typename Engine>
+        struct EngineTypeId
+        {
+            static constexpr std::uint32_t VALUE = 0;
+        };
+
+        template <> struct EngineTypeId<std::mt19937>      { static constexpr std::uint32_t VALUE = 1; };
+        template <> struct EngineTypeId<std::mt19937_64>   { static constexpr std::uint32_t VALUE = 2; };
+        template <> struct EngineTypeId<Xoshiro256Engine>  { static constexpr std::uint32_t VALUE = 3; };
+        template <> struct EngineTypeId<Pcg64Engine>       { static constexpr std::uint32_t VALUE = 4; };
+        template <> struct EngineTypeId<PhiloxEngine>      { static constexpr std::uint32_t VALUE = 5; };
+        template <> struct EngineTypeId<PrefetchingEngine> { static constexpr std::uint32_t VALUE = 6; };
+
+        /**
+         * @brief   navis::engine::EngineTraits
+         * @details Engine specific seeding and raw word generation used by navis::base::BasicRandomizer
+         *          The generic version supports engines producing full 32-bit or 64-bit words
+         */
+        template <typename Engine>
+        struct EngineTraits
+        {
+            using result_type = typename Engine::result_type;
+
+            static_assert(Engine::min() == 0, "Engine must produce full-width words");
+            static_assert(Engine::max() == std::numeric_limits<std::uint32_t>::max() ||
+                          Engine::max() == std::numeric_limits<std::uint64_t>::max(), "Engine must produce full-width words");
+
+            /**
+             * @brief Snapshot engine type identifier, see EngineTypeId
+             */
+            static constexpr std::uint32_t TYPE_ID = EngineTypeId<Engine>::VALUE;
+
+            /**
+             * @brief Engine output width in 32-bit words
+             */
+            static constexpr std::size_t WORDS_PER_OUTPUT = (Engine::max() > std::numeric_limits<std::uint32_t>::max()) ? 2 : 1;
+
+            /**
+             * @brief True for engines seeded through a seed sequence (the standard engines)
+             *        These are seeded through SplitMixSeedSequence, so a randomizer over std::mt19937 does not replay
+             *        the sequence of std::mt19937(seed), not even on stream 0
+             */
+            static constexpr bool IS_SEQUENCE_SEEDED = std::is_constructible<Engine, SplitMixSeedSequence &>::value;
+
+            /**
+             * @brief Number of seed bits used by the engine
+             *        A seed sequence consumes the whole 64-bit seed, a scalar seed is kept modulo the engine word size
+             */
+            static constexpr int SEED_BITS = (IS_SEQUENCE_SEEDED || WORDS_PER_OUTPUT == 2) ? 64 : 32;
+
+            /**
+             * @brief Engine seed of the selected substream, for engines seeded by a scalar
+             * @param localSeed Local random seed
+             * @param streamId Stream identifier (0 keeps the plain seeded sequence)
+             */
+            static result_type streamSeed(std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                return static_cast<result_type>((streamId == 0) ? localSeed : splitMix64(localSeed + streamId * GOLDEN_GAMMA));
+            }
+
+            /**
+             * @brief Engine construction function for the selected substream
+             * @param localSeed Local random seed
+             * @param streamId Stream identifier
+             */
+            static Engine create(std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                if constexpr(IS_SEQUENCE_SEEDED)
+                {
+                    SplitMixSeedSequence sequence(localSeed, streamId);
+                    return Engine(sequence);
+                }
+                else
+                {
+                    return Engine(streamSeed(localSeed, streamId));
+                }
+            }
+
+            /**
+             * @brief Engine seeding function for the selected substream
+             * @param generator Random number engine
+             * @param localSeed Local random seed
+             * @param streamId Stream identifier
+             */
+            static void seed(Engine &generator, std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                if constexpr(IS_SEQUENCE_SEEDED)
+                {
+                    SplitMixSeedSequence sequence(localSeed, streamId);
+                    generator.seed(sequence);
+                }
+                else
+                {
+                    generator.seed(streamSeed(localSeed, streamId));
+                }
+            }
+
+            /**
+             * @brief Engine state capture and restore functions, see saveEngineState() and loadEngineState()
+             * @param generator Random number engine
+             * @param words State words
+             * @param size Number of state words
+             */
+            static void saveState(const Engine &generator, std::vector<std::uint64_t> &words)
+            {
+                saveEngineState(generator, words);
+            }
+
+            static bool loadState(Engine &generator, const std::uint64_t *words, std::size_t size)
+            {
+                return loadEngineState(generator, words, size);
+            }
+
+            /**
+             * @brief 32-bit random word generation function
+             *        64-bit engines return the upper half of one output
+             * @param generator Random number engine
+             */
+            static std::uint32_t next32(Engine &generator)
+            {
+                if(WORDS_PER_OUTPUT == 1)
+                {
+                    return static_cast<std::uint32_t>(generator());
+                }
+                return static_cast<std::uint32_t>(static_cast<std::uint64_t>(generator()) >> 32);
+            }
+
+            /**
+             * @brief 64-bit random word generation function
+             *        32-bit engines combine two outputs, the first one is the low half
+             * @param generator Random number engine
+             */
+            static std::uint64_t next64(Engine &generator)
+            {
+                if(WORDS_PER_OUTPUT == 2)
+                {
+                    return static_cast<std::uint64_t>(generator());
+                }
+                std::uint64_t low = static_cast<std::uint32_t>(generator());
+                return low | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(generator())) << 32);
+            }
+
+            /**
+             * @brief Random word block generation function
+             * @param generator Random number engine
+             * @param words Output word buffer
+             * @param size Number of 32-bit words
+             */
+            static void generateWords(Engine &generator, std::uint32_t *words, std::size_t size)
+            {
+                if(WORDS_PER_OUTPUT == 1)
+                {
+                    for(std::size_t index = 0; index < size; ++index)
+                    {
+                        words[index] = static_cast<std::uint32_t>(generator());
+                    }
+                    return;
+                }
+
+                std::size_t index = 0;
+                for(; index + 2 <= size; index += 2)
+                {
+                    std::uint64_t value = static_cast<std::uint64_t>(generator());
+                    words[index]     = static_cast<std::uint32_t>(value);
+                    words[index + 1] = static_cast<std::uint32_t>(value >> 32);
+                }
+                if(index < size)
+                {
+                    words[index] = static_cast<std::uint32_t>(generator());
+                }
+            }
+        };
+
+        /**
+         * @brief Philox selects the substream through the counter
+         */
+        template <>
+        struct EngineTraits<PhiloxEngine>
+        {
+            static constexpr std::uint32_t TYPE_ID = EngineTypeId<PhiloxEngine>::VALUE;
+            static constexpr int SEED_BITS = 64;
+            static constexpr std::size_t WORDS_PER_OUTPUT = 1;
+
+            static PhiloxEngine create(std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                return PhiloxEngine(localSeed, streamId);
+            }
+
+            static void seed(PhiloxEngine &generator, std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                generator.seed(localSeed, streamId);
+            }
+
+            static void saveState(const PhiloxEngine &generator, std::vector<std::uint64_t> &words)
+            {
+                words.push_back(generator.getSeed());
+                words.push_back(generator.getStream());
+                words.push_back(generator.getPosition());
+            }
+
+            static bool loadState(PhiloxEngine &generator, const std::uint64_t *words, std::size_t size)
+            {
+                if(size != 3)
+                {
+                    return false;
+                }
+                generator.seed(words[0], words[1]);
+                generator.discard(words[2]);
+                return true;
+            }
+
+            static std::uint32_t next32(PhiloxEngine &generator)
+            {
+                return generator();
+            }
+
+            static std::uint64_t next64(PhiloxEngine &generator)
+            {
+                std::uint64_t low = generator();
+                return low | (static_cast<std::uint64_t>(generator()) << 32);
+            }
+
+            static void generateWords(PhiloxEngine &generator, std::uint32_t *words, std::size_t size)
+            {
+                generator.generate(words, size);
+            }
+        };
+
+        /**
+         * @brief PCG64 selects the substream through the LCG increment
+         */
+        template <>
+        struct EngineTraits<Pcg64Engine>
+        {
+            static constexpr std::uint32_t TYPE_ID = EngineTypeId<Pcg64Engine>::VALUE;
+            static constexpr int SEED_BITS = 64;
+            static constexpr std::size_t WORDS_PER_OUTPUT = 2;
+
+            static Pcg64Engine create(std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                return Pcg64Engine(localSeed, streamId);
+            }
+
+            static void seed(Pcg64Engine &generator, std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                generator.seed(localSeed, streamId);
+            }
+
+            static void saveState(const Pcg64Engine &generator, std::vector<std::uint64_t> &words)
+            {
+                const Pcg64Engine::StateType state     = generator.getState();
+                const Pcg64Engine::StateType increment = generator.getIncrement();
+                words.push_back(static_cast<std::uint64_t>(state));
+                words.push_back(static_cast<std::uint64_t>(state >> 64));
+                words.push_back(static_cast<std::uint64_t>(increment));
+                words.push_back(static_cast<std::uint64_t>(increment >> 64));
+            }
+
+            static bool loadState(Pcg64Engine &generator, const std::uint64_t *words, std::size_t size)
+            {
+                if(size != 4 || (words[2] & 1) == 0)
+                {
+                    return false;
+                }
+                generator.setState((static_cast<Pcg64Engine::StateType>(words[1]) << 64) | words[0],
+                                   (static_cast<Pcg64Engine::StateType>(words[3]) << 64) | words[2]);
+                return true;
+            }
+
+            static std::uint32_t next32(Pcg64Engine &generator)
+            {
+                return static_cast<std::uint32_t>(generator() >> 32);
+            }
+
+            static std::uint64_t next64(Pcg64Engine &generator)
+            {
+                return generator();
+            }
+
+            static void generateWords(Pcg64Engine &generator, std::uint32_t *words, std::size_t size)
+            {
+                std::size_t index = 0;
+                for(; index + 2 <= size; index += 2)
+                {
+                    std::uint64_t value = generator();
+                    words[index]     = static_cast<std::uint32_t>(value);
+                    words[index + 1] = static_cast<std::uint32_t>(value >> 32);
+                }
+                if(index < size)
+                {
+                    words[index] = static_cast<std::uint32_t>(generator());
+                }
+            }
+        };
+
+        /**
+         * @brief The prefetching engine replays the Philox stream, substreams select the counter the same way
+         */
+        template <>
+        struct EngineTraits<PrefetchingEngine>
+        {
+            static constexpr std::uint32_t TYPE_ID = EngineTypeId<PrefetchingEngine>::VALUE;
+            static constexpr int SEED_BITS = 64;
+            static constexpr std::size_t WORDS_PER_OUTPUT = 1;
+
+            static PrefetchingEngine create(std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                return PrefetchingEngine(localSeed, streamId);
+            }
+
+            static void seed(PrefetchingEngine &generator, std::uint_fast64_t localSeed, std::uint_fast64_t streamId)
+            {
+                generator.seed(localSeed, streamId);
+            }
+
+            static void saveState(const PrefetchingEngine &generator, std::vector<std::uint64_t> &words)
+            {
+                words.push_back(generator.getSeed());
+                words.push_back(generator.getStream());
+                words.push_back(generator.getPosition());
+            }
+
+            static bool loadState(PrefetchingEngine &generator, const std::uint64_t *words, std::size_t size)
+            {
+                if(size != 3)
+                {
+                    return false;
+                }
+                generator.seed(words[0], words[1]);
+                generator.discard(words[2]);
+                return true;
+            }
+
+            static std::uint32_t next32(PrefetchingEngine &generator)
+            {
+                return generator();
+            }
+
+            static std::uint64_t next64(PrefetchingEngine &generator)
+            {
+                std::uint64_t low = generator();
+                return low | (static_cast<std::uint64_t>(generator()) << 32);
+            }
+
+            static void generateWords(PrefetchingEngine &generator, std::uint32_t *words, std::size_t size)
+            {
+                generator.generate(words, size);
+            }
+        };
+
+    } // namespace engine
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_ENGINE_ENGINETRAITS_H_
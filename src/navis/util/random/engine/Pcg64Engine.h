@@ -0,0 +1,174 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    Pcg64Engine.h
+ * @brief   PCG64 (XSL-RR 128/64) Random Number Engine Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_ENGINE_PCG64ENGINE_H_
+#define NAVIS_UTIL_RANDOM_ENGINE_PCG64ENGINE_H_
+
+#include <cstdint>
+#include <limits>
+
+#if !defined(__SIZEOF_INT128__)
+    #error "Pcg64Engine requires 128-bit integer support"
+#endif
+
+namespace navis
+{
+    namespace engine
+    {
+        /**
+         * @brief   navis::engine::Pcg64Engine
+         * @details PCG64 XSL-RR 128/64 (O'Neill), 32 bytes of state, period 2^128 per stream
+         *          The LCG increment selects one of 2^127 streams. Satisfies UniformRandomBitGenerator.
+         */
+        class Pcg64Engine
+        {
+            public:
+
+                using result_type = std::uint64_t;
+                using StateType   = unsigned __int128;
+
+                static constexpr std::uint_fast64_t default_seed = 0xCAFEF00DD15EA5E5ULL;
+
+            // "Pcg64Engine" members
+            private:
+
+                static constexpr StateType MULTIPLIER = (static_cast<StateType>(2549297995355413924ULL) << 64) | 4865540595714422341ULL;
+
+                StateType m_state;
+                StateType m_increment;
+
+            // "Pcg64Engine" methods
+            private:
+
+                /**
+                 * @brief LCG step method
+                 */
+                void step()
+                {
+                    m_state = m_state * MULTIPLIER + m_increment;
+                }
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param seed Initial state (default : default_seed)
+                 * @param stream Stream identifier (default : 0)
+                 */
+                Pcg64Engine()
+                  : Pcg64Engine(default_seed)
+                {
+                }
+
+                explicit Pcg64Engine(std::uint_fast64_t seed, std::uint_fast64_t stream = 0)
+                {
+                    this->seed(seed, stream);
+                }
+
+                /**
+                 * @brief Minimum and maximum value of the engine output
+                 */
+                static constexpr result_type min() { return 0; }
+                static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+                /**
+                 * @brief Engine seed setter method
+                 * @param seed Initial state
+                 * @param stream Stream identifier (default : 0)
+                 */
+                void seed(std::uint_fast64_t seed = default_seed, std::uint_fast64_t stream = 0)
+                {
+                    m_state     = 0;
+                    m_increment = (static_cast<StateType>(stream) << 1) | 1U;
+                    step();
+                    m_state += seed;
+                    step();
+                }
+
+                /**
+                 * @brief Random number generation operator
+                 */
+                result_type operator()()
+                {
+                    step();
+
+                    auto rotation = static_cast<unsigned>(m_state >> 122);
+                    auto xored    = static_cast<std::uint64_t>(m_state >> 64) ^ static_cast<std::uint64_t>(m_state);
+                    return (xored >> rotation) | (xored << ((64 - rotation) & 63));
+                }
+
+                /**
+                 * @brief Skip values in O(log count) by LCG jump-ahead (Brown, "Random Number Generation with Arbitrary Strides")
+                 * @param count Number of values to skip
+                 */
+                void discard(unsigned long long count)
+                {
+                    StateType multiplier    = MULTIPLIER;
+                    StateType increment     = m_increment;
+                    StateType accMultiplier = 1;
+                    StateType accIncrement  = 0;
+
+                    for(; count > 0; count >>= 1)
+                    {
+                        if(count & 1)
+                        {
+                            accMultiplier *= multiplier;
+                            accIncrement   = accIncrement * multiplier + increment;
+                        }
+                        increment   = (multiplier + 1) * increment;
+                        multiplier *= multiplier;
+                    }
+                    m_state = accMultiplier * m_state + accIncrement;
+                }
+
+                /**
+                 * @brief Raw state accessor methods
+                 */
+                StateType getState() const
+                {
+                    return m_state;
+                }
+
+                StateType getIncrement() const
+                {
+                    return m_increment;
+                }
+
+                void setState(StateType state, StateType increment)
+                {
+                    m_state     = state;
+                    m_increment = increment | 1U;
+                }
+
+                /**
+                 * @brief Comparison operator
+                 */
+                friend bool operator==(const Pcg64Engine &lhs, const Pcg64Engine &rhs)
+                {
+                    return lhs.m_state == rhs.m_state && lhs.m_increment == rhs.m_increment;
+                }
+
+                friend bool operator!=(const Pcg64Engine &lhs, const Pcg64Engine &rhs)
+                {
+                    return !(lhs == rhs);
+                }
+
+        }; // class Pcg64Engine
+
+    } // namespace engine
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_ENGINE_PCG64ENGINE_H_
@@ -0,0 +1,250 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    PhiloxEngine.h
+ * @brief   Philox4x32-10 Counter-Based Random Number Engine Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_ENGINE_PHILOXENGINE_H_
+#define NAVIS_UTIL_RANDOM_ENGINE_PHILOXENGINE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace navis
+{
+    namespace engine
+    {
+        /**
+         * @brief   navis::engine::PhiloxEngine
+         * @details Philox4x32-10 counter-based engine (Salmon et al., "Parallel Random Numbers: As Easy as 1, 2, 3")
+         *          Value N of a stream is a pure function of (key, stream, N), which gives O(1) jump-ahead
+         *          and independent parallel substreams. Satisfies UniformRandomBitGenerator.
+         *
+         *          Counter layout : words [0, 1] = block index, words [2, 3] = stream identifier
+         *          Key layout     : words [0, 1] = 64-bit seed
+         */
+        class PhiloxEngine
+        {
+            public:
+
+                using result_type  = std::uint32_t;
+                using CounterType  = std::array<std::uint32_t, 4>;
+                using KeyType      = std::array<std::uint32_t, 2>;
+
+                static constexpr std::uint_fast64_t default_seed = 20111115U;
+
+            // "PhiloxEngine" members
+            private:
+
+                static constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53U;
+                static constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57U;
+                static constexpr std::uint32_t WEYL_0       = 0x9E3779B9U;
+                static constexpr std::uint32_t WEYL_1       = 0xBB67AE85U;
+                static constexpr int           ROUNDS       = 10;
+
+                KeyType m_key;
+                std::uint64_t m_stream;
+                std::uint64_t m_position;
+                CounterType m_buffer{};
+
+            // "PhiloxEngine" methods
+            private:
+
+                /**
+                 * @brief Refill the output buffer with the block containing the current position
+                 */
+                void refill()
+                {
+                    m_buffer = block(makeCounter(m_position >> 2, m_stream), m_key);
+                }
+
+                /**
+                 * @brief Counter construction method
+                 * @param blockIndex Block index within the stream
+                 * @param stream Stream identifier
+                 */
+                static CounterType makeCounter(std::uint64_t blockIndex, std::uint64_t stream)
+                {
+                    return {static_cast<std::uint32_t>(blockIndex), static_cast<std::uint32_t>(blockIndex >> 32),
+                            static_cast<std::uint32_t>(stream),     static_cast<std::uint32_t>(stream >> 32)};
+                }
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param seed Engine key (default : default_seed)
+                 * @param stream Stream identifier (default : 0)
+                 */
+                PhiloxEngine()
+                  : PhiloxEngine(default_seed)
+                {
+                }
+
+                explicit PhiloxEngine(std::uint_fast64_t seed, std::uint_fast64_t stream = 0)
+                {
+                    this->seed(seed, stream);
+                }
+
+                /**
+                 * @brief Philox4x32-10 bijection
+                 * @param counter 128-bit counter
+                 * @param key 64-bit key
+                 */
+                static CounterType block(CounterType counter, KeyType key)
+                {
+                    for(int round = 0; round < ROUNDS; ++round)
+                    {
+                        std::uint64_t product0 = static_cast<std::uint64_t>(MULTIPLIER_0) * counter[0];
+                        std::uint64_t product1 = static_cast<std::uint64_t>(MULTIPLIER_1) * counter[2];
+
+                        counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0],
+                                   static_cast<std::uint32_t>(product1),
+                                   static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1],
+                                   static_cast<std::uint32_t>(product0)};
+
+                        key[0] += WEYL_0;
+                        key[1] += WEYL_1;
+                    }
+                    return counter;
+                }
+
+                /**
+                 * @brief Minimum and maximum value of the engine output
+                 */
+                static constexpr result_type min() { return 0; }
+                static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+                /**
+                 * @brief Engine seed setter method, restart at the beginning of the stream
+                 * @param seed Engine key
+                 * @param stream Stream identifier (default : 0)
+                 */
+                void seed(std::uint_fast64_t seed = default_seed, std::uint_fast64_t stream = 0)
+                {
+                    m_key      = {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(static_cast<std::uint64_t>(seed) >> 32)};
+                    m_stream   = stream;
+                    m_position = 0;
+                }
+
+                /**
+                 * @brief Stream identifier setter method, restart at the beginning of the stream
+                 * @param stream Stream identifier
+                 */
+                void setStream(std::uint_fast64_t stream)
+                {
+                    m_stream   = stream;
+                    m_position = 0;
+                }
+
+                /**
+                 * @brief Engine key getter method
+                 */
+                std::uint_fast64_t getSeed() const
+                {
+                    return m_key[0] | (static_cast<std::uint64_t>(m_key[1]) << 32);
+                }
+
+                /**
+                 * @brief Stream identifier getter method
+                 */
+                std::uint_fast64_t getStream() const
+                {
+                    return m_stream;
+                }
+
+                /**
+                 * @brief Number of values consumed from the current stream
+                 */
+                std::uint64_t getPosition() const
+                {
+                    return m_position;
+                }
+
+                /**
+                 * @brief Random number generation operator
+                 */
+                result_type operator()()
+                {
+                    if((m_position & 3) == 0)
+                    {
+                        refill();
+                    }
+                    return m_buffer[m_position++ & 3];
+                }
+
+                /**
+                 * @brief Skip values in O(1)
+                 * @param count Number of values to skip
+                 */
+                void discard(unsigned long long count)
+                {
+                    m_position += count;
+
+                    if((m_position & 3) != 0)
+                    {
+                        refill();
+                    }
+                }
+
+                /**
+                 * @brief Block generation method, equivalent to size calls of operator()
+                 * @param output Output buffer
+                 * @param size Number of values
+                 */
+                void generate(result_type *output, std::size_t size)
+                {
+                    // Drain the partially consumed block first
+                    for(; size > 0 && (m_position & 3) != 0; --size)
+                    {
+                        *output++ = m_buffer[m_position++ & 3];
+                    }
+
+                    // Whole blocks are independent of each other and are generated straight into the output
+                    for(; size >= 4; size -= 4, output += 4)
+                    {
+                        CounterType values = block(makeCounter(m_position >> 2, m_stream), m_key);
+                        output[0] = values[0];
+                        output[1] = values[1];
+                        output[2] = values[2];
+                        output[3] = values[3];
+                        m_position += 4;
+                    }
+
+                    for(; size > 0; --size)
+                    {
+                        *output++ = (*this)();
+                    }
+                }
+
+                /**
+                 * @brief Comparison operator
+                 */
+                friend bool operator==(const PhiloxEngine &lhs, const PhiloxEngine &rhs)
+                {
+                    return lhs.m_key == rhs.m_key && lhs.m_stream == rhs.m_stream && lhs.m_position == rhs.m_position;
+                }
+
+                friend bool operator!=(const PhiloxEngine &lhs, const PhiloxEngine &rhs)
+                {
+                    return !(lhs == rhs);
+                }
+
+        }; // class PhiloxEngine
+
+    } // namespace engine
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_ENGINE_PHILOXENGINE_H_
@@ -0,0 +1,253 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    PrefetchingEngine.h
+ * @brief   Prefetching Random Number Engine Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_ENGINE_PREFETCHINGENGINE_H_
+#define NAVIS_UTIL_RANDOM_ENGINE_PREFETCHINGENGINE_H_
+
+#include "navis/util/random/engine/PhiloxEngine.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace navis
+{
+    namespace engine
+    {
+        /**
+         * @brief Prefetching engine counters
+         * @param blocksProduced Blocks generated by the background thread
+         * @param blocksConsumed Blocks taken from the ring by the consumer
+         * @param underruns Blocks the consumer had to generate itself because the ring was empty
+         * @param stalls Times the background thread found the ring full and parked
+         */
+        struct PrefetchStatistics
+        {
+            std::uint64_t blocksProduced {0};
+            std::uint64_t blocksConsumed {0};
+            std::uint64_t underruns {0};
+            std::uint64_t stalls {0};
+        };
+
+        /**
+         * @brief   navis::engine::PrefetchingEngine
+         * @details Philox4x32-10 stream generated ahead of use by a background thread
+         *          The thread fills a lock-free single-producer single-consumer ring of blocks tagged with their block index,
+         *          the consuming thread only copies words out of the ring. When the ring is empty the consumer computes
+         *          the block itself (Philox jumps in O(1)), so the output never waits and always equals
+         *          navis::engine::PhiloxEngine with the same seed and stream, whatever the thread timing.
+         *          A full ring parks the thread on a condition variable, the consumer signals it after freeing a slot
+         *          and only when it is parked, so the consumer never takes the lock while the thread is generating.
+         *          One consumer thread per engine, like any other engine.
+         */
+        class PrefetchingEngine
+        {
+            public:
+
+                using result_type = std::uint32_t;
+
+                static constexpr std::uint_fast64_t default_seed = PhiloxEngine::default_seed;
+
+                /**
+                 * @brief Default number of 32-bit words per block and of blocks in the ring
+                 */
+                static constexpr std::size_t DEFAULT_BLOCK_SIZE    = 4096;
+                static constexpr std::size_t DEFAULT_RING_CAPACITY = 8;
+
+            // "PrefetchingEngine" members
+            private:
+
+                /**
+                 * @brief Ring slot, a block of words and its index in the stream
+                 */
+                struct Slot
+                {
+                    std::uint64_t blockIndex {0};
+                    std::vector<std::uint32_t> words;
+                };
+
+                std::uint64_t m_seed;
+                std::uint64_t m_stream;
+                std::size_t m_blockSize {DEFAULT_BLOCK_SIZE};
+                std::size_t m_capacity {DEFAULT_RING_CAPACITY};
+                std::unique_ptr<Slot[]> m_slots;
+
+                /**
+                 * @brief Ring positions, written by the producer (head) and the consumer (tail) only
+                 */
+                alignas(64) std::atomic<std::uint64_t> m_head {0};
+                alignas(64) std::atomic<std::uint64_t> m_tail {0};
+
+                /**
+                 * @brief First block the consumer still needs, the producer skips anything older
+                 */
+                alignas(64) std::atomic<std::uint64_t> m_requiredBlock {0};
+                std::atomic<bool> m_isRunning {false};
+                std::thread m_producer;
+
+                /**
+                 * @brief Parking of the background thread on a full ring
+                 */
+                std::mutex m_parkMutex;
+                std::condition_variable m_parkCondition;
+                std::atomic<bool> m_isProducerParked {false};
+
+                std::atomic<std::uint64_t> m_blocksProduced {0};
+                std::atomic<std::uint64_t> m_stalls {0};
+
+                /**
+                 * @brief Consumer state : current block words, read offset, index of the next block
+                 */
+                alignas(64) const std::uint32_t *m_current {nullptr};
+                std::size_t m_offset {DEFAULT_BLOCK_SIZE};
+                std::uint64_t m_nextBlock {0};
+                bool m_isHoldingSlot {false};
+                std::vector<std::uint32_t> m_fallback;
+                PhiloxEngine m_fallbackEngine;
+
+                std::uint64_t m_blocksConsumed {0};
+                std::uint64_t m_underruns {0};
+
+            // "PrefetchingEngine" methods
+            private:
+
+                /**
+                 * @brief Allocate the ring, reset the consumer to the position and start the background thread
+                 * @param position Word position within the stream
+                 */
+                void start(std::uint64_t position);
+
+                /**
+                 * @brief Stop and join the background thread
+                 */
+                void stop();
+
+                /**
+                 * @brief Background thread loop
+                 */
+                void produce();
+
+                /**
+                 * @brief Wake the background thread if it is parked, called after the consumer freed ring slots
+                 */
+                void wakeProducer();
+
+                /**
+                 * @brief Make the next block current, from the ring or synchronously on underrun
+                 */
+                void nextBlock();
+
+            public:
+
+                /**
+                 * @brief Class constructor, starts the background thread
+                 * @param seed Engine key (default : default_seed)
+                 * @param stream Stream identifier (default : 0)
+                 */
+                PrefetchingEngine();
+                explicit PrefetchingEngine(std::uint_fast64_t seed, std::uint_fast64_t stream = 0);
+
+                /**
+                 * @brief Class destructor, stops the background thread
+                 */
+                ~PrefetchingEngine();
+
+                PrefetchingEngine(const PrefetchingEngine &) = delete;
+                PrefetchingEngine &operator=(const PrefetchingEngine &) = delete;
+
+                /**
+                 * @brief Minimum and maximum value of the engine output
+                 */
+                static constexpr result_type min() { return 0; }
+                static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+                /**
+                 * @brief Engine seed setter method, restart at the beginning of the stream
+                 * @param seed Engine key
+                 * @param stream Stream identifier (default : 0)
+                 */
+                void seed(std::uint_fast64_t seed = default_seed, std::uint_fast64_t stream = 0);
+
+                /**
+                 * @brief Ring geometry setter method, the stream position is kept
+                 * @param blockSize Number of 32-bit words per block (multiple of 4)
+                 * @param ringCapacity Number of blocks in the ring
+                 */
+                void configure(std::size_t blockSize, std::size_t ringCapacity);
+
+                /**
+                 * @brief Random number generation operator
+                 */
+                result_type operator()()
+                {
+                    if(m_offset == m_blockSize)
+                    {
+                        nextBlock();
+                    }
+                    return m_current[m_offset++];
+                }
+
+                /**
+                 * @brief Bulk generation method
+                 * @param output Output buffer
+                 * @param size Number of words to generate
+                 */
+                void generate(std::uint32_t *output, std::size_t size);
+
+                /**
+                 * @brief Advance the engine state
+                 * @param count Number of outputs to skip
+                 */
+                void discard(unsigned long long count);
+
+                /**
+                 * @brief Engine key and stream identifier getter methods
+                 */
+                std::uint_fast64_t getSeed() const
+                {
+                    return m_seed;
+                }
+
+                std::uint_fast64_t getStream() const
+                {
+                    return m_stream;
+                }
+
+                /**
+                 * @brief Position within the stream getter method (number of words consumed)
+                 */
+                std::uint64_t getPosition() const
+                {
+                    return m_nextBlock * m_blockSize + m_offset - m_blockSize;
+                }
+
+                /**
+                 * @brief Counter snapshot getter method
+                 */
+                PrefetchStatistics getStatistics() const;
+
+        }; // class PrefetchingEngine
+
+    } // namespace engine
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_ENGINE_PREFETCHINGENGINE_H_
@@ -0,0 +1,267 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    Xoshiro256Engine.h
+ * @brief   xoshiro256** Random Number Engine Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_ENGINE_XOSHIRO256ENGINE_H_
+#define NAVIS_UTIL_RANDOM_ENGINE_XOSHIRO256ENGINE_H_
+
+#include <array>
+#include <cstdint>
+#include <limits>
+
+namespace navis
+{
+    namespace engine
+    {
+        /**
+         * @brief   navis::engine::Xoshiro256Engine
+         * @details xoshiro256** 1.0 (Blackman and Vigna), 32 bytes of state, period 2^256 - 1
+         *          Satisfies UniformRandomBitGenerator.
+         */
+        class Xoshiro256Engine
+        {
+            public:
+
+                using result_type = std::uint64_t;
+                using StateType   = std::array<std::uint64_t, 4>;
+
+                static constexpr std::uint_fast64_t default_seed = 0x853C49E6748FEA9BULL;
+
+            // "Xoshiro256Engine" members
+            private:
+
+                /**
+                 * @brief Characteristic polynomial of the state transition over GF(2), x^256 term implied
+                 *        x^(2^128) mod this polynomial is the jump() polynomial
+                 */
+                static constexpr StateType CHARACTERISTIC_POLYNOMIAL {0x9D116F2BB0F0F001ULL, 0x0280002BCEFD1A5EULL, 0x04B4EDCF26259F85ULL, 0x0003C03C3F3ECB19ULL};
+
+                /**
+                 * @brief Below this count discard() steps the engine, above it jumps by polynomial
+                 */
+                static constexpr unsigned long long JUMP_THRESHOLD = 1ULL << 16;
+
+                StateType m_state;
+
+            // "Xoshiro256Engine" methods
+            private:
+
+                /**
+                 * @brief Bit rotation function
+                 */
+                static constexpr std::uint64_t rotl(std::uint64_t value, int shift)
+                {
+                    return (value << shift) | (value >> (64 - shift));
+                }
+
+                /**
+                 * @brief Product of two polynomials modulo the characteristic polynomial
+                 * @param lhs Polynomial coefficients, bit i of word i / 64 is the coefficient of x^i
+                 * @param rhs Polynomial coefficients
+                 */
+                static StateType multiplyModulo(const StateType &lhs, StateType rhs)
+                {
+                    StateType product {0, 0, 0, 0};
+
+                    for(int bit = 0; bit < 256; ++bit)
+                    {
+                        if(lhs[bit >> 6] & (1ULL << (bit & 63)))
+                        {
+                            for(int index = 0; index < 4; ++index)
+                            {
+                                product[index] ^= rhs[index];
+                            }
+                        }
+
+                        // rhs *= x, reduced when the x^256 term appears
+                        const bool isOverflow = (rhs[3] >> 63) != 0;
+                        rhs[3] = (rhs[3] << 1) | (rhs[2] >> 63);
+                        rhs[2] = (rhs[2] << 1) | (rhs[1] >> 63);
+                        rhs[1] = (rhs[1] << 1) | (rhs[0] >> 63);
+                        rhs[0] =  rhs[0] << 1;
+                        if(isOverflow)
+                        {
+                            for(int index = 0; index < 4; ++index)
+                            {
+                                rhs[index] ^= CHARACTERISTIC_POLYNOMIAL[index];
+                            }
+                        }
+                    }
+                    return product;
+                }
+
+                /**
+                 * @brief Apply a jump polynomial to the state
+                 * @param polynomial Jump polynomial coefficients
+                 */
+                void jump(const StateType &polynomial)
+                {
+                    StateType state {0, 0, 0, 0};
+
+                    for(std::uint64_t word : polynomial)
+                    {
+                        for(int bit = 0; bit < 64; ++bit)
+                        {
+                            if(word & (1ULL << bit))
+                            {
+                                for(int index = 0; index < 4; ++index)
+                                {
+                                    state[index] ^= m_state[index];
+                                }
+                            }
+                            (*this)();
+                        }
+                    }
+                    m_state = state;
+                }
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param seed Seed expanded to the full state by splitmix64 (default : default_seed)
+                 */
+                Xoshiro256Engine()
+                  : Xoshiro256Engine(default_seed)
+                {
+                }
+
+                explicit Xoshiro256Engine(std::uint_fast64_t seed)
+                {
+                    this->seed(seed);
+                }
+
+                /**
+                 * @brief Minimum and maximum value of the engine output
+                 */
+                static constexpr result_type min() { return 0; }
+                static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+                /**
+                 * @brief Engine seed setter method
+                 * @param seed Seed expanded to the full state by splitmix64
+                 */
+                void seed(std::uint_fast64_t seed = default_seed)
+                {
+                    std::uint64_t weyl = seed;
+                    for(auto &word : m_state)
+                    {
+                        weyl += 0x9E3779B97F4A7C15ULL;
+                        std::uint64_t mixed = weyl;
+                        mixed = (mixed ^ (mixed >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                        mixed = (mixed ^ (mixed >> 27)) * 0x94D049BB133111EBULL;
+                        word  = mixed ^ (mixed >> 31);
+                    }
+                }
+
+                /**
+                 * @brief Random number generation operator
+                 */
+                result_type operator()()
+                {
+                    const std::uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+                    const std::uint64_t shifted = m_state[1] << 17;
+
+                    m_state[2] ^= m_state[0];
+                    m_state[3] ^= m_state[1];
+                    m_state[1] ^= m_state[2];
+                    m_state[0] ^= m_state[3];
+                    m_state[2] ^= shifted;
+                    m_state[3] = rotl(m_state[3], 45);
+
+                    return result;
+                }
+
+                /**
+                 * @brief Skip values in O(log count)
+                 *        The transition T is linear over GF(2), T^count equals p(T) with p = x^count mod the characteristic polynomial,
+                 *        p is built by square-and-multiply and applied like the jump() polynomials (256 steps)
+                 * @param count Number of values to skip
+                 */
+                void discard(unsigned long long count)
+                {
+                    if(count < JUMP_THRESHOLD)
+                    {
+                        for(; count > 0; --count)
+                        {
+                            (*this)();
+                        }
+                        return;
+                    }
+
+                    StateType polynomial {1, 0, 0, 0};
+                    StateType power {2, 0, 0, 0};
+                    for(; count > 0; count >>= 1)
+                    {
+                        if(count & 1)
+                        {
+                            polynomial = multiplyModulo(polynomial, power);
+                        }
+                        if(count > 1)
+                        {
+                            power = multiplyModulo(power, power);
+                        }
+                    }
+                    jump(polynomial);
+                }
+
+                /**
+                 * @brief Advance the state by 2^128 outputs, generates 2^128 non-overlapping subsequences
+                 */
+                void jump()
+                {
+                    jump({0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL});
+                }
+
+                /**
+                 * @brief Advance the state by 2^192 outputs, generates 2^64 non-overlapping subsequences
+                 */
+                void longJump()
+                {
+                    jump({0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL, 0x77710069854EE241ULL, 0x39109BB02ACBE635ULL});
+                }
+
+                /**
+                 * @brief Raw state accessor methods
+                 */
+                const StateType &getState() const
+                {
+                    return m_state;
+                }
+
+                void setState(const StateType &state)
+                {
+                    m_state = state;
+                }
+
+                /**
+                 * @brief Comparison operator
+                 */
+                friend bool operator==(const Xoshiro256Engine &lhs, const Xoshiro256Engine &rhs)
+                {
+                    return lhs.m_state == rhs.m_state;
+                }
+
+                friend bool operator!=(const Xoshiro256Engine &lhs, const Xoshiro256Engine &rhs)
+                {
+                    return !(lhs == rhs);
+                }
+
+        }; // class Xoshiro256Engine
+
+    } // namespace engine
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_ENGINE_XOSHIRO256ENGINE_H_
@@ -0,0 +1,294 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    PrefetchingEngine.cpp
+ * @brief   Prefetching Random Number Engine Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/engine/PrefetchingEngine.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+/**
+ * @brief Class constructor, starts the background thread
+ */
+navis::engine::PrefetchingEngine::PrefetchingEngine()
+  : PrefetchingEngine(default_seed)
+{
+}
+
+/**
+ * @brief Class constructor, starts the background thread
+ * @param seed Engine key
+ * @param stream Stream identifier (default : 0)
+ */
+navis::engine::PrefetchingEngine::PrefetchingEngine(std::uint_fast64_t seed, std::uint_fast64_t stream)
+  : m_seed(seed)
+  , m_stream(stream)
+{
+    start(0);
+}
+
+/**
+ * @brief Class destructor, stops the background thread
+ */
+navis::engine::PrefetchingEngine::~PrefetchingEngine()
+{
+    stop();
+}
+
+/**
+ * @brief Allocate the ring, reset the consumer to the position and start the background thread
+ * @param position Word position within the stream
+ */
+void navis::engine::PrefetchingEngine::start(std::uint64_t position)
+{
+    assert(m_blockSize > 0 && m_blockSize % 4 == 0 && m_capacity > 0);
+
+    m_slots.reset(new Slot[m_capacity]);
+    for(std::size_t index = 0; index < m_capacity; ++index)
+    {
+        m_slots[index].words.resize(m_blockSize);
+    }
+    m_fallback.resize(m_blockSize);
+    m_fallbackEngine.seed(m_seed, m_stream);
+
+    m_head.store(0, std::memory_order_relaxed);
+    m_tail.store(0, std::memory_order_relaxed);
+
+    // Consumer positioned on the block holding the position, loaded lazily by the first draw
+    m_current       = nullptr;
+    m_isHoldingSlot = false;
+    m_nextBlock     = position / m_blockSize;
+    m_offset        = m_blockSize;
+    m_requiredBlock.store(m_nextBlock, std::memory_order_relaxed);
+
+    if(position % m_blockSize != 0)
+    {
+        nextBlock();
+        m_offset = position % m_blockSize;
+    }
+
+    m_isProducerParked.store(false, std::memory_order_relaxed);
+    m_isRunning.store(true, std::memory_order_release);
+    m_producer = std::thread(&PrefetchingEngine::produce, this);
+}
+
+/**
+ * @brief Stop and join the background thread
+ */
+void navis::engine::PrefetchingEngine::stop()
+{
+    {
+        std::lock_guard<std::mutex> parkLock(m_parkMutex);
+        m_isRunning.store(false, std::memory_order_release);
+    }
+    m_parkCondition.notify_one();
+
+    if(m_producer.joinable())
+    {
+        m_producer.join();
+    }
+}
+
+/**
+ * @brief Background thread loop
+ */
+void navis::engine::PrefetchingEngine::produce()
+{
+    PhiloxEngine generator(m_seed, m_stream);
+    std::uint64_t blockIndex = m_requiredBlock.load(std::memory_order_relaxed);
+    generator.discard(blockIndex * m_blockSize);
+
+    while(m_isRunning.load(std::memory_order_acquire))
+    {
+        const std::uint64_t head = m_head.load(std::memory_order_relaxed);
+        if(head - m_tail.load(std::memory_order_acquire) == m_capacity)
+        {
+            // Ring full : announce the parking before the last check of the tail, pairs with the fence of wakeProducer()
+            m_stalls.fetch_add(1, std::memory_order_relaxed);
+
+            std::unique_lock<std::mutex> parkLock(m_parkMutex);
+            m_isProducerParked.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            m_parkCondition.wait(parkLock, [this, head]()
+            {
+                return !m_isRunning.load(std::memory_order_acquire) ||
+                       head - m_tail.load(std::memory_order_acquire) < m_capacity;
+            });
+            m_isProducerParked.store(false, std::memory_order_relaxed);
+            continue;
+        }
+
+        // Skip blocks the consumer already generated itself or discarded
+        const std::uint64_t required = m_requiredBlock.load(std::memory_order_relaxed);
+        if(blockIndex < required)
+        {
+            generator.discard((required - blockIndex) * m_blockSize);
+            blockIndex = required;
+        }
+
+        Slot &slot = m_slots[head % m_capacity];
+        generator.generate(slot.words.data(), m_blockSize);
+        slot.blockIndex = blockIndex++;
+
+        m_head.store(head + 1, std::memory_order_release);
+        m_blocksProduced.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Wake the background thread if it is parked, called after the consumer freed ring slots
+ */
+void navis::engine::PrefetchingEngine::wakeProducer()
+{
+    // Pairs with the fence of produce() : either the thread sees the new tail or this sees it parked
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(m_isProducerParked.load(std::memory_order_relaxed))
+    {
+        {
+            std::lock_guard<std::mutex> parkLock(m_parkMutex);
+        }
+        m_parkCondition.notify_one();
+    }
+}
+
+/**
+ * @brief Make the next block current, from the ring or synchronously on underrun
+ */
+void navis::engine::PrefetchingEngine::nextBlock()
+{
+    const std::uint64_t initialTail = m_tail.load(std::memory_order_relaxed);
+    std::uint64_t tail = initialTail;
+    if(m_isHoldingSlot)
+    {
+        m_tail.store(++tail, std::memory_order_release);
+        m_isHoldingSlot = false;
+    }
+
+    const std::uint64_t blockIndex = m_nextBlock++;
+    m_requiredBlock.store(m_nextBlock, std::memory_order_relaxed);
+    m_offset = 0;
+
+    while(tail != m_head.load(std::memory_order_acquire))
+    {
+        const Slot &slot = m_slots[tail % m_capacity];
+        if(slot.blockIndex == blockIndex)
+        {
+            m_current = slot.words.data();
+            m_isHoldingSlot = true;
+            ++m_blocksConsumed;
+            if(tail != initialTail)
+            {
+                wakeProducer();
+            }
+            return;
+        }
+
+        // Stale block, produced before an underrun or a discard
+        m_tail.store(++tail, std::memory_order_release);
+    }
+
+    // Underrun : the same block computed in place
+    m_fallbackEngine.seed(m_seed, m_stream);
+    m_fallbackEngine.discard(blockIndex * m_blockSize);
+    m_fallbackEngine.generate(m_fallback.data(), m_blockSize);
+    m_current = m_fallback.data();
+    ++m_underruns;
+    if(tail != initialTail)
+    {
+        wakeProducer();
+    }
+}
+
+/**
+ * @brief Engine seed setter method, restart at the beginning of the stream
+ * @param seed Engine key
+ * @param stream Stream identifier (default : 0)
+ */
+void navis::engine::PrefetchingEngine::seed(std::uint_fast64_t seed, std::uint_fast64_t stream)
+{
+    stop();
+    m_seed   = seed;
+    m_stream = stream;
+    start(0);
+}
+
+/**
+ * @brief Ring geometry setter method, the stream position is kept
+ * @param blockSize Number of 32-bit words per block (multiple of 4)
+ * @param ringCapacity Number of blocks in the ring
+ */
+void navis::engine::PrefetchingEngine::configure(std::size_t blockSize, std::size_t ringCapacity)
+{
+    const std::uint64_t position = getPosition();
+    stop();
+    m_blockSize = blockSize;
+    m_capacity  = ringCapacity;
+    start(position);
+}
+
+/**
+ * @brief Bulk generation method
+ * @param output Output buffer
+ * @param size Number of words to generate
+ */
+void navis::engine::PrefetchingEngine::generate(std::uint32_t *output, std::size_t size)
+{
+    while(size > 0)
+    {
+        if(m_offset == m_blockSize)
+        {
+            nextBlock();
+        }
+
+        const std::size_t count = std::min(size, m_blockSize - m_offset);
+        std::memcpy(output, m_current + m_offset, count * sizeof(std::uint32_t));
+
+        m_offset += count;
+        output   += count;
+        size     -= count;
+    }
+}
+
+/**
+ * @brief Advance the engine state
+ * @param count Number of outputs to skip
+ */
+void navis::engine::PrefetchingEngine::discard(unsigned long long count)
+{
+    if(count <= m_blockSize - m_offset)
+    {
+        m_offset += count;
+        return;
+    }
+
+    // Jump : every block before the target one becomes stale
+    const std::uint64_t position = getPosition() + count;
+    m_nextBlock = position / m_blockSize;
+    nextBlock();
+    m_offset = position % m_blockSize;
+}
+
+/**
+ * @brief Counter snapshot getter method
+ */
+navis::engine::PrefetchStatistics navis::engine::PrefetchingEngine::getStatistics() const
+{
+    PrefetchStatistics statistics;
+    statistics.blocksProduced = m_blocksProduced.load(std::memory_order_relaxed);
+    statistics.blocksConsumed = m_blocksConsumed;
+    statistics.underruns      = m_underruns;
+    statistics.stalls         = m_stalls.load(std::memory_order_relaxed);
+    return statistics;
+}
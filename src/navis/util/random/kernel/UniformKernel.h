@@ -0,0 +1,83 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    UniformKernel.h
+ * @brief   Uniform Random Bits Conversion Kernel Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#ifndef NAVIS_UTIL_RANDOM_KERNEL_UNIFORMKERNEL_H_
+#define NAVIS_UTIL_RANDOM_KERNEL_UNIFORMKERNEL_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace navis
+{
+    namespace kernel
+    {
+        /**
+         * @brief   Block conversion of raw 32-bit random words to uniform values
+         * @details Every kernel has an AVX2, SSE2 and scalar implementation selected at compile time.
+         *          All implementations consume the random words in the same order and use the same
+         *          bit manipulation, so the produced distribution does not depend on the instruction set.
+         */
+
+        /**
+         * @brief Number of random words consumed per output value
+         */
+        constexpr std::size_t WORDS_PER_DOUBLE = 2;
+        constexpr std::size_t WORDS_PER_FLOAT  = 1;
+        constexpr std::size_t WORDS_PER_INT    = 1;
+        constexpr std::size_t BOOLS_PER_WORD   = 32;
+
+        /**
+         * @brief Convert random words to real numbers in [lowerBound, upperBound) with 52-bit resolution
+         * @param bits Random words (size * WORDS_PER_DOUBLE elements)
+         * @param output Output buffer (size elements)
+         * @param size Number of output values
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         */
+        void bitsToDouble(const std::uint32_t *bits, double *output, std::size_t size, double lowerBound, double upperBound);
+
+        /**
+         * @brief Convert random words to real numbers in [lowerBound, upperBound) with 23-bit resolution
+         * @param bits Random words (size * WORDS_PER_FLOAT elements)
+         * @param output Output buffer (size elements)
+         * @param size Number of output values
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         */
+        void bitsToFloat(const std::uint32_t *bits, float *output, std::size_t size, float lowerBound, float upperBound);
+
+        /**
+         * @brief Convert random words to integer numbers in [lowerBound, upperBound] by multiply-shift
+         * @param bits Random words (size * WORDS_PER_INT elements)
+         * @param output Output buffer (size elements)
+         * @param size Number of output values
+         * @param lowerBound Lower boundary of the result
+         * @param upperBound Upper boundary of the result
+         */
+        void bitsToInt(const std::uint32_t *bits, int *output, std::size_t size, int lowerBound, int upperBound);
+
+        /**
+         * @brief Expand random words to boolean values, one bit per value (LSB first)
+         * @param bits Random words (ceil(size / BOOLS_PER_WORD) elements)
+         * @param output Output buffer (size elements)
+         * @param size Number of output values
+         */
+        void bitsToBool(const std::uint32_t *bits, bool *output, std::size_t size);
+
+    } // namespace kernel
+
+} // namespace navis
+
+#endif // NAVIS_UTIL_RANDOM_KERNEL_UNIFORMKERNEL_H_
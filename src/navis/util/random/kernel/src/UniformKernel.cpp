@@ -0,0 +1,255 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    UniformKernel.cpp
+ * @brief   Uniform Random Bits Conversion Kernel Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/kernel/UniformKernel.h"
+
+#include <cstring>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+#elif defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+namespace
+{
+    static_assert(sizeof(bool) == 1, "Boolean kernel writes one byte per value");
+
+    /**
+     * @brief IEEE-754 exponent bits of 1.0
+     */
+    constexpr std::uint64_t DOUBLE_ONE_BITS = 0x3FF0000000000000ULL;
+    constexpr std::uint32_t FLOAT_ONE_BITS  = 0x3F800000U;
+
+    /**
+     * @brief Scalar conversion of two random words to a real number in [0, 1)
+     * @param low Low random word
+     * @param high High random word
+     */
+    inline double toUnitDouble(std::uint32_t low, std::uint32_t high)
+    {
+        std::uint64_t word = ((static_cast<std::uint64_t>(high) << 32) | low) >> 12 | DOUBLE_ONE_BITS;
+
+        double result;
+        std::memcpy(&result, &word, sizeof(result));
+        return result - 1.0;
+    }
+
+    /**
+     * @brief Scalar conversion of a random word to a real number in [0, 1)
+     * @param word Random word
+     */
+    inline float toUnitFloat(std::uint32_t word)
+    {
+        word = (word >> 9) | FLOAT_ONE_BITS;
+
+        float result;
+        std::memcpy(&result, &word, sizeof(result));
+        return result - 1.0f;
+    }
+
+} // namespace
+
+/**
+ * @brief Convert random words to real numbers in [lowerBound, upperBound) with 52-bit resolution
+ * @param bits Random words (size * WORDS_PER_DOUBLE elements)
+ * @param output Output buffer (size elements)
+ * @param size Number of output values
+ * @param lowerBound Lower boundary of the result
+ * @param upperBound Upper boundary of the result
+ */
+void navis::kernel::bitsToDouble(const std::uint32_t *bits, double *output, std::size_t size, double lowerBound, double upperBound)
+{
+    const double range = upperBound - lowerBound;
+    std::size_t index = 0;
+
+#if defined(__AVX2__)
+    const __m256i oneBits = _mm256_set1_epi64x(static_cast<long long>(DOUBLE_ONE_BITS));
+    const __m256d one     = _mm256_set1_pd(1.0);
+    const __m256d lower   = _mm256_set1_pd(lowerBound);
+    const __m256d scale   = _mm256_set1_pd(range);
+
+    for(; index + 4 <= size; index += 4)
+    {
+        __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bits + index * WORDS_PER_DOUBLE));
+        words = _mm256_or_si256(_mm256_srli_epi64(words, 12), oneBits);
+
+        __m256d unit = _mm256_sub_pd(_mm256_castsi256_pd(words), one);
+        _mm256_storeu_pd(output + index, _mm256_add_pd(_mm256_mul_pd(unit, scale), lower));
+    }
+
+#elif defined(__SSE2__)
+    const __m128i oneBits = _mm_set1_epi64x(static_cast<long long>(DOUBLE_ONE_BITS));
+    const __m128d one     = _mm_set1_pd(1.0);
+    const __m128d lower   = _mm_set1_pd(lowerBound);
+    const __m128d scale   = _mm_set1_pd(range);
+
+    for(; index + 2 <= size; index += 2)
+    {
+        __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bits + index * WORDS_PER_DOUBLE));
+        words = _mm_or_si128(_mm_srli_epi64(words, 12), oneBits);
+
+        __m128d unit = _mm_sub_pd(_mm_castsi128_pd(words), one);
+        _mm_storeu_pd(output + index, _mm_add_pd(_mm_mul_pd(unit, scale), lower));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        output[index] = toUnitDouble(bits[2 * index], bits[2 * index + 1]) * range + lowerBound;
+    }
+}
+
+/**
+ * @brief Convert random words to real numbers in [lowerBound, upperBound) with 23-bit resolution
+ * @param bits Random words (size * WORDS_PER_FLOAT elements)
+ * @param output Output buffer (size elements)
+ * @param size Number of output values
+ * @param lowerBound Lower boundary of the result
+ * @param upperBound Upper boundary of the result
+ */
+void navis::kernel::bitsToFloat(const std::uint32_t *bits, float *output, std::size_t size, float lowerBound, float upperBound)
+{
+    const float range = upperBound - lowerBound;
+    std::size_t index = 0;
+
+#if defined(__AVX2__)
+    const __m256i oneBits = _mm256_set1_epi32(static_cast<int>(FLOAT_ONE_BITS));
+    const __m256  one     = _mm256_set1_ps(1.0f);
+    const __m256  lower   = _mm256_set1_ps(lowerBound);
+    const __m256  scale   = _mm256_set1_ps(range);
+
+    for(; index + 8 <= size; index += 8)
+    {
+        __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bits + index));
+        words = _mm256_or_si256(_mm256_srli_epi32(words, 9), oneBits);
+
+        __m256 unit = _mm256_sub_ps(_mm256_castsi256_ps(words), one);
+        _mm256_storeu_ps(output + index, _mm256_add_ps(_mm256_mul_ps(unit, scale), lower));
+    }
+
+#elif defined(__SSE2__)
+    const __m128i oneBits = _mm_set1_epi32(static_cast<int>(FLOAT_ONE_BITS));
+    const __m128  one     = _mm_set1_ps(1.0f);
+    const __m128  lower   = _mm_set1_ps(lowerBound);
+    const __m128  scale   = _mm_set1_ps(range);
+
+    for(; index + 4 <= size; index += 4)
+    {
+        __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bits + index));
+        words = _mm_or_si128(_mm_srli_epi32(words, 9), oneBits);
+
+        __m128 unit = _mm_sub_ps(_mm_castsi128_ps(words), one);
+        _mm_storeu_ps(output + index, _mm_add_ps(_mm_mul_ps(unit, scale), lower));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        output[index] = toUnitFloat(bits[index]) * range + lowerBound;
+    }
+}
+
+/**
+ * @brief Convert random words to integer numbers in [lowerBound, upperBound] by multiply-shift
+ * @param bits Random words (size * WORDS_PER_INT elements)
+ * @param output Output buffer (size elements)
+ * @param size Number of output values
+ * @param lowerBound Lower boundary of the result
+ * @param upperBound Upper boundary of the result
+ */
+void navis::kernel::bitsToInt(const std::uint32_t *bits, int *output, std::size_t size, int lowerBound, int upperBound)
+{
+    const std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(upperBound) - lowerBound) + 1;
+    const std::uint32_t lower = static_cast<std::uint32_t>(lowerBound);
+    std::size_t index = 0;
+
+    // Full 32-bit range : every random word is already an uniform integer
+    if(range > UINT32_MAX)
+    {
+        for(; index < size; ++index)
+        {
+            output[index] = static_cast<int>(bits[index] + lower);
+        }
+        return;
+    }
+
+#if defined(__AVX2__)
+    const __m256i scale = _mm256_set1_epi32(static_cast<int>(range));
+    const __m256i base  = _mm256_set1_epi32(static_cast<int>(lower));
+
+    for(; index + 8 <= size; index += 8)
+    {
+        __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(bits + index));
+        __m256i even  = _mm256_srli_epi64(_mm256_mul_epu32(words, scale), 32);
+        __m256i odd   = _mm256_mul_epu32(_mm256_srli_epi64(words, 32), scale);
+
+        __m256i result = _mm256_blend_epi32(even, odd, 0xAA);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + index), _mm256_add_epi32(result, base));
+    }
+
+#elif defined(__SSE2__)
+    const __m128i scale   = _mm_set1_epi32(static_cast<int>(range));
+    const __m128i base    = _mm_set1_epi32(static_cast<int>(lower));
+    const __m128i oddMask = _mm_set_epi32(-1, 0, -1, 0);
+
+    for(; index + 4 <= size; index += 4)
+    {
+        __m128i words = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bits + index));
+        __m128i even  = _mm_srli_epi64(_mm_mul_epu32(words, scale), 32);
+        __m128i odd   = _mm_and_si128(_mm_mul_epu32(_mm_srli_epi64(words, 32), scale), oddMask);
+
+        __m128i result = _mm_or_si128(even, odd);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + index), _mm_add_epi32(result, base));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        auto offset = static_cast<std::uint32_t>((static_cast<std::uint64_t>(bits[index]) * range) >> 32);
+        output[index] = static_cast<int>(offset + lower);
+    }
+}
+
+/**
+ * @brief Expand random words to boolean values, one bit per value (LSB first)
+ * @param bits Random words (ceil(size / BOOLS_PER_WORD) elements)
+ * @param output Output buffer (size elements)
+ * @param size Number of output values
+ */
+void navis::kernel::bitsToBool(const std::uint32_t *bits, bool *output, std::size_t size)
+{
+    std::size_t index = 0;
+
+#if defined(__AVX2__)
+    // Replicate byte k of the word into output bytes [8k, 8k + 8) and test one bit per byte
+    const __m256i spread = _mm256_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+                                            2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3);
+    const __m256i select = _mm256_set1_epi64x(static_cast<long long>(0x8040201008040201ULL));
+    const __m256i one    = _mm256_set1_epi8(1);
+
+    for(; index + BOOLS_PER_WORD <= size; index += BOOLS_PER_WORD)
+    {
+        __m256i word  = _mm256_shuffle_epi8(_mm256_set1_epi32(static_cast<int>(bits[index / BOOLS_PER_WORD])), spread);
+        __m256i flags = _mm256_cmpeq_epi8(_mm256_and_si256(word, select), select);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(output + index), _mm256_and_si256(flags, one));
+    }
+#endif
+
+    for(; index < size; ++index)
+    {
+        output[index] = (bits[index / BOOLS_PER_WORD] >> (index % BOOLS_PER_WORD)) & 1U;
+    }
+}
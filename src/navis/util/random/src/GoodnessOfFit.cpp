@@ -0,0 +1,238 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    GoodnessOfFit.cpp
+ * @brief   Random Sample Goodness-Of-Fit Functions Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/GoodnessOfFit.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Sample moments computation function
+ * @param samples Sample buffer
+ * @param size Number of samples
+ */
+navis::util::SampleMoments navis::util::computeMoments(const double *samples, std::size_t size)
+{
+    SampleMoments moments;
+    if(size < 2)
+    {
+        moments.mean = (size == 1) ? samples[0] : 0.0;
+        return moments;
+    }
+
+    double sum = 0.0;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        sum += samples[index];
+    }
+    moments.mean = sum / static_cast<double>(size);
+
+    // Central moments in a second pass for numerical stability
+    double m2 = 0.0, m3 = 0.0, m4 = 0.0;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        double delta  = samples[index] - moments.mean;
+        double delta2 = delta * delta;
+        m2 += delta2;
+        m3 += delta2 * delta;
+        m4 += delta2 * delta2;
+    }
+
+    double count = static_cast<double>(size);
+    moments.variance = m2 / (count - 1.0);
+
+    if(m2 > 0.0)
+    {
+        m2 /= count;
+        m3 /= count;
+        m4 /= count;
+        moments.skewness       = m3 / std::pow(m2, 1.5);
+        moments.excessKurtosis = m4 / (m2 * m2) - 3.0;
+    }
+    return moments;
+}
+
+/**
+ * @brief Standard normal cumulative distribution function
+ * @param x Evaluation point
+ */
+double navis::util::normalCdf(double x)
+{
+    return 0.5 * std::erfc(-x / std::sqrt(2.0));
+}
+
+/**
+ * @brief One-sample Kolmogorov-Smirnov statistic D = sup |F_n(x) - F(x)|
+ * @param samples Sample buffer (copied and sorted internally)
+ * @param size Number of samples
+ * @param cdf Reference cumulative distribution function
+ */
+double navis::util::kolmogorovSmirnovStatistic(const double *samples, std::size_t size, const std::function<double(double)> &cdf)
+{
+    std::vector<double> sorted(samples, samples + size);
+    std::sort(sorted.begin(), sorted.end());
+
+    double statistic = 0.0;
+    double count = static_cast<double>(size);
+
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        double reference = cdf(sorted[index]);
+        double above = static_cast<double>(index + 1) / count - reference;
+        double below = reference - static_cast<double>(index) / count;
+        statistic = std::max(statistic, std::max(above, below));
+    }
+    return statistic;
+}
+
+/**
+ * @brief Asymptotic p-value of the Kolmogorov-Smirnov statistic (Stephens' small sample correction)
+ * @param statistic Kolmogorov-Smirnov statistic D
+ * @param size Number of samples
+ */
+double navis::util::kolmogorovSmirnovPValue(double statistic, std::size_t size)
+{
+    double root = std::sqrt(static_cast<double>(size));
+    double lambda = (root + 0.12 + 0.11 / root) * statistic;
+
+    if(lambda < 0.2)
+    {
+        return 1.0;
+    }
+
+    // Kolmogorov distribution tail : 2 sum_{k >= 1} (-1)^(k-1) exp(-2 k^2 lambda^2)
+    double pValue = 0.0;
+    for(int term = 1; term <= 100; ++term)
+    {
+        double value = 2.0 * std::exp(-2.0 * term * term * lambda * lambda);
+        pValue += (term % 2 == 1) ? value : -value;
+
+        if(value < 1e-12)
+        {
+            break;
+        }
+    }
+    return std::min(1.0, std::max(0.0, pValue));
+}
+
+/**
+ * @brief Pearson chi-square statistic sum (O_i - E_i)^2 / E_i
+ * @param observed Observed bin counts
+ * @param expected Expected bin counts (positive)
+ * @param size Number of bins
+ */
+double navis::util::chiSquareStatistic(const double *observed, const double *expected, std::size_t size)
+{
+    double statistic = 0.0;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        double delta = observed[index] - expected[index];
+        statistic += delta * delta / expected[index];
+    }
+    return statistic;
+}
+
+/**
+ * @brief Upper tail p-value of the chi-square distribution, regularized incomplete gamma Q(k / 2, x / 2)
+ * @param statistic Chi-square statistic
+ * @param degreesOfFreedom Degrees of freedom (non-zero)
+ */
+double navis::util::chiSquarePValue(double statistic, std::size_t degreesOfFreedom)
+{
+    const double a = 0.5 * static_cast<double>(degreesOfFreedom);
+    const double x = 0.5 * statistic;
+
+    if(!(x > 0.0))
+    {
+        return 1.0;
+    }
+
+    const double logPrefix = a * std::log(x) - x - std::lgamma(a);
+
+    if(x < a + 1.0)
+    {
+        // Series of the lower function P(a, x)
+        double term = 1.0 / a;
+        double sum  = term;
+        for(int index = 1; index < 1000 && std::fabs(term) > std::fabs(sum) * 1e-15; ++index)
+        {
+            term *= x / (a + index);
+            sum  += term;
+        }
+        return std::min(1.0, std::max(0.0, 1.0 - sum * std::exp(logPrefix)));
+    }
+
+    // Continued fraction of Q(a, x), modified Lentz
+    const double tiny = 1e-300;
+    double b = x + 1.0 - a;
+    double c = 1.0 / tiny;
+    double d = 1.0 / b;
+    double fraction = d;
+    for(int index = 1; index < 1000; ++index)
+    {
+        const double an = -index * (index - a);
+        b += 2.0;
+        d = an * d + b;
+        d = (std::fabs(d) < tiny) ? tiny : d;
+        c = b + an / c;
+        c = (std::fabs(c) < tiny) ? tiny : c;
+        d = 1.0 / d;
+
+        const double delta = d * c;
+        fraction *= delta;
+        if(std::fabs(delta - 1.0) < 1e-15)
+        {
+            break;
+        }
+    }
+    return std::min(1.0, std::max(0.0, fraction * std::exp(logPrefix)));
+}
+
+/**
+ * @brief Pearson correlation coefficient, 0 when either sample is constant
+ * @param first First sample buffer
+ * @param second Second sample buffer
+ * @param size Number of sample pairs
+ */
+double navis::util::correlation(const double *first, const double *second, std::size_t size)
+{
+    if(size < 2)
+    {
+        return 0.0;
+    }
+
+    double firstMean = 0.0, secondMean = 0.0;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        firstMean  += first[index];
+        secondMean += second[index];
+    }
+    firstMean  /= static_cast<double>(size);
+    secondMean /= static_cast<double>(size);
+
+    double covariance = 0.0, firstVariance = 0.0, secondVariance = 0.0;
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        const double firstDelta  = first[index] - firstMean;
+        const double secondDelta = second[index] - secondMean;
+        covariance     += firstDelta * secondDelta;
+        firstVariance  += firstDelta * firstDelta;
+        secondVariance += secondDelta * secondDelta;
+    }
+
+    const double scale = std::sqrt(firstVariance * secondVariance);
+    return (scale > 0.0) ? covariance / scale : 0.0;
+}
@@ -0,0 +1,385 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    GridDensitySampler.cpp
+ * @brief   Grid Density Importance Sampler Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/GridDensitySampler.h"
+
+#include <algorithm>
+#include <utility>
+
+/**
+ * @brief Class constructor
+ * @param sizeX, sizeY Number of cells per axis
+ * @param resolution Cell edge length [m]
+ * @param originX, originY World position of the lower corner of cell (0, 0) [m]
+ */
+navis::util::GridDensitySampler::GridDensitySampler(std::size_t sizeX, std::size_t sizeY, double resolution, double originX, double originY)
+  : m_dimension(2)
+  , m_size{sizeX, sizeY, 1}
+  , m_tileEdge(TILE_EDGE_2D)
+  , m_tileCount{(sizeX + TILE_EDGE_2D - 1) / TILE_EDGE_2D, (sizeY + TILE_EDGE_2D - 1) / TILE_EDGE_2D, 1}
+  , m_resolution(resolution)
+  , m_origin{originX, originY, 0.0}
+{
+    assert(sizeX > 0 && sizeY > 0 && resolution > 0.0);
+}
+
+/**
+ * @brief Class constructor
+ * @param sizeX, sizeY, sizeZ Number of cells per axis
+ * @param resolution Cell edge length [m]
+ * @param originX, originY, originZ World position of the lower corner of cell (0, 0, 0) [m]
+ */
+navis::util::GridDensitySampler::GridDensitySampler(std::size_t sizeX, std::size_t sizeY, std::size_t sizeZ, double resolution,
+                                                    double originX, double originY, double originZ)
+  : m_dimension(3)
+  , m_size{sizeX, sizeY, sizeZ}
+  , m_tileEdge(TILE_EDGE_3D)
+  , m_tileCount{(sizeX + TILE_EDGE_3D - 1) / TILE_EDGE_3D, (sizeY + TILE_EDGE_3D - 1) / TILE_EDGE_3D, (sizeZ + TILE_EDGE_3D - 1) / TILE_EDGE_3D}
+  , m_resolution(resolution)
+  , m_origin{originX, originY, originZ}
+{
+    assert(sizeX > 0 && sizeY > 0 && sizeZ > 0 && resolution > 0.0);
+}
+
+/**
+ * @brief Tile index and offset inside the tile of a cell
+ * @param x, y, z Cell coordinates
+ * @param offset Offset inside the tile
+ */
+std::size_t navis::util::GridDensitySampler::locate(std::size_t x, std::size_t y, std::size_t z, std::size_t &offset) const
+{
+    assert(x < m_size[0] && y < m_size[1] && z < m_size[2]);
+    offset = (x % m_tileEdge) + m_tileEdge * ((y % m_tileEdge) + m_tileEdge * (z % m_tileEdge));
+    return (x / m_tileEdge) + m_tileCount[0] * ((y / m_tileEdge) + m_tileCount[1] * (z / m_tileEdge));
+}
+
+/**
+ * @brief Mark a tile slot for the next rebuild()
+ * @param slot Tile slot
+ */
+void navis::util::GridDensitySampler::markDirty(std::size_t slot)
+{
+    if(!m_isDirty[slot])
+    {
+        m_isDirty[slot] = true;
+        m_dirtyTiles.push_back(slot);
+    }
+}
+
+/**
+ * @brief Cell index of a draw
+ * @param tileWord Tile selection word
+ * @param cellWord Cell selection word
+ */
+std::size_t navis::util::GridDensitySampler::selectCell(std::uint64_t tileWord, std::uint64_t cellWord) const
+{
+    const Tile &tile = m_tiles[m_top.select(tileWord)];
+    const std::size_t offset = tile.offsets[tile.table.select(cellWord)];
+
+    const std::size_t tileX = tile.index % m_tileCount[0];
+    const std::size_t tileY = (tile.index / m_tileCount[0]) % m_tileCount[1];
+    const std::size_t tileZ = tile.index / (m_tileCount[0] * m_tileCount[1]);
+
+    return getCellIndex(tileX * m_tileEdge + offset % m_tileEdge,
+                        tileY * m_tileEdge + (offset / m_tileEdge) % m_tileEdge,
+                        tileZ * m_tileEdge + offset / (m_tileEdge * m_tileEdge));
+}
+
+/**
+ * @brief Position of a draw, the words are tile, cell and one jitter per axis
+ * @param words Random words (2 + dimension)
+ * @param position Output position (dimension elements)
+ * @param stride Distance between the position components
+ */
+void navis::util::GridDensitySampler::place(const std::uint64_t *words, double *position, std::size_t stride) const
+{
+    std::size_t cell = selectCell(words[0], words[1]);
+
+    for(std::size_t axis = 0; axis < m_dimension; ++axis)
+    {
+        const double jitter = static_cast<double>(words[2 + axis] >> 11) * 0x1.0p-53;
+        position[axis * stride] = m_origin[axis] + (static_cast<double>(cell % m_size[axis]) + jitter) * m_resolution;
+        cell /= m_size[axis];
+    }
+}
+
+/**
+ * @brief Number of non-zero cells getter method
+ */
+std::size_t navis::util::GridDensitySampler::getNonZeroCount() const
+{
+    std::size_t count = 0;
+    for(const Tile &tile : m_tiles)
+    {
+        count += tile.offsets.size();
+    }
+    return count;
+}
+
+/**
+ * @brief Density getter method
+ * @param x, y, z Cell coordinates
+ */
+double navis::util::GridDensitySampler::getDensity(std::size_t x, std::size_t y, std::size_t z) const
+{
+    std::size_t offset;
+    auto slot = m_tileSlots.find(locate(x, y, z, offset));
+    if(slot == m_tileSlots.end())
+    {
+        return 0.0;
+    }
+
+    const Tile &tile = m_tiles[slot->second];
+    auto position = std::lower_bound(tile.offsets.begin(), tile.offsets.end(), offset);
+    return (position != tile.offsets.end() && *position == offset) ? tile.densities[position - tile.offsets.begin()] : 0.0;
+}
+
+/**
+ * @brief Density setter method, takes effect on the next rebuild()
+ * @param x, y Cell coordinates
+ * @param density Non-negative density, zero releases the cell
+ */
+void navis::util::GridDensitySampler::setDensity(std::size_t x, std::size_t y, double density)
+{
+    assert(m_dimension == 2);
+    setDensity(x, y, 0, density);
+}
+
+/**
+ * @brief Density setter method, takes effect on the next rebuild()
+ * @param x, y, z Cell coordinates
+ * @param density Non-negative density, zero releases the cell
+ */
+void navis::util::GridDensitySampler::setDensity(std::size_t x, std::size_t y, std::size_t z, double density)
+{
+    assert(density >= 0.0);
+
+    std::size_t offset;
+    const std::size_t index = locate(x, y, z, offset);
+    auto slot = m_tileSlots.find(index);
+
+    if(slot == m_tileSlots.end())
+    {
+        if(!(density > 0.0))
+        {
+            return;
+        }
+
+        slot = m_tileSlots.emplace(index, m_tiles.size()).first;
+        m_tiles.push_back(Tile{index, {}, {}, {}});
+        m_tileWeights.push_back(0.0);
+        m_isDirty.push_back(false);
+    }
+
+    Tile &tile = m_tiles[slot->second];
+    auto position = std::lower_bound(tile.offsets.begin(), tile.offsets.end(), offset);
+    const std::size_t at = position - tile.offsets.begin();
+    const bool isStored = (position != tile.offsets.end() && *position == offset);
+
+    if(density > 0.0)
+    {
+        if(isStored)
+        {
+            tile.densities[at] = density;
+        }
+        else
+        {
+            tile.offsets.insert(position, static_cast<std::uint16_t>(offset));
+            tile.densities.insert(tile.densities.begin() + at, density);
+        }
+    }
+    else if(isStored)
+    {
+        tile.offsets.erase(position);
+        tile.densities.erase(tile.densities.begin() + at);
+    }
+    else
+    {
+        return;
+    }
+
+    markDirty(slot->second);
+}
+
+/**
+ * @brief Replace every density from a dense grid, takes effect on the next rebuild()
+ * @param densities Non-negative densities (getCellCount() elements, x runs fastest)
+ */
+void navis::util::GridDensitySampler::setDensities(const double *densities)
+{
+    clear();
+    setWindow(0, 0, 0, m_size[0], m_size[1], m_size[2], densities);
+}
+
+/**
+ * @brief Set a rectangular window of densities, e.g. the updated bounds of a costmap layer
+ *        Visits the window tile by tile and merges each tile's stored cells with the window in one pass
+ * @param x, y, z Lower corner of the window
+ * @param width, height, depth Window size in cells
+ * @param densities Non-negative densities (width * height * depth elements, x runs fastest)
+ */
+void navis::util::GridDensitySampler::setWindow(std::size_t x, std::size_t y, std::size_t z, std::size_t width, std::size_t height, std::size_t depth,
+                                                const double *densities)
+{
+    assert(x + width <= m_size[0] && y + height <= m_size[1] && z + depth <= m_size[2]);
+    if(width == 0 || height == 0 || depth == 0)
+    {
+        return;
+    }
+
+    const std::size_t lower[3] = {x, y, z};
+    const std::size_t upper[3] = {x + width, y + height, z + depth};
+    const std::size_t edge = m_tileEdge;
+    std::vector<std::uint16_t> offsets;
+    std::vector<double> values;
+
+    for(std::size_t tileZ = z / edge; tileZ * edge < upper[2]; ++tileZ)
+    {
+        for(std::size_t tileY = y / edge; tileY * edge < upper[1]; ++tileY)
+        {
+            for(std::size_t tileX = x / edge; tileX * edge < upper[0]; ++tileX)
+            {
+                const std::size_t index = tileX + m_tileCount[0] * (tileY + m_tileCount[1] * tileZ);
+                auto slot = m_tileSlots.find(index);
+                const Tile *stored = (slot != m_tileSlots.end()) ? &m_tiles[slot->second] : nullptr;
+                std::size_t next = 0;
+
+                offsets.clear();
+                values.clear();
+
+                // Cells of the tile in offset order, window values replace the stored ones
+                const std::size_t cellCount = (m_dimension == 2) ? edge * edge : edge * edge * edge;
+                for(std::size_t offset = 0; offset < cellCount; ++offset)
+                {
+                    const std::size_t cell[3] = {tileX * edge + offset % edge, tileY * edge + (offset / edge) % edge, tileZ * edge + offset / (edge * edge)};
+                    double value = 0.0;
+
+                    if(stored != nullptr && next < stored->offsets.size() && stored->offsets[next] == offset)
+                    {
+                        value = stored->densities[next++];
+                    }
+
+                    if(cell[0] >= lower[0] && cell[0] < upper[0] && cell[1] >= lower[1] && cell[1] < upper[1] && cell[2] >= lower[2] && cell[2] < upper[2])
+                    {
+                        value = densities[(cell[0] - x) + width * ((cell[1] - y) + height * (cell[2] - z))];
+                        assert(value >= 0.0);
+                    }
+
+                    if(value > 0.0)
+                    {
+                        offsets.push_back(static_cast<std::uint16_t>(offset));
+                        values.push_back(value);
+                    }
+                }
+
+                if(stored == nullptr)
+                {
+                    if(offsets.empty())
+                    {
+                        continue;
+                    }
+
+                    slot = m_tileSlots.emplace(index, m_tiles.size()).first;
+                    m_tiles.push_back(Tile{index, {}, {}, {}});
+                    m_tileWeights.push_back(0.0);
+                    m_isDirty.push_back(false);
+                }
+
+                Tile &tile = m_tiles[slot->second];
+                tile.offsets.swap(offsets);
+                tile.densities.swap(values);
+                markDirty(slot->second);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Remove every density and release the tiles
+ */
+void navis::util::GridDensitySampler::clear()
+{
+    m_tiles.clear();
+    m_tileSlots.clear();
+    m_tileWeights.clear();
+    m_isDirty.clear();
+    m_dirtyTiles.clear();
+    m_top.build(nullptr, 0);
+}
+
+/**
+ * @brief Rebuild the dirty tiles and the top table, emptied tiles are released
+ * @return False when all densities are zero, the sampler must not be drawn from until densities are set
+ */
+bool navis::util::GridDensitySampler::rebuild()
+{
+    bool hasEmptyTile = false;
+    for(std::size_t slot : m_dirtyTiles)
+    {
+        Tile &tile = m_tiles[slot];
+        tile.table.build(tile.densities.data(), tile.densities.size());
+        m_tileWeights[slot] = tile.table.getTotalWeight();
+        m_isDirty[slot] = false;
+        hasEmptyTile = hasEmptyTile || tile.offsets.empty();
+    }
+    m_dirtyTiles.clear();
+
+    // Swap emptied tiles with the last slot, only dirty tiles can be empty
+    for(std::size_t slot = 0; hasEmptyTile && slot < m_tiles.size();)
+    {
+        if(!m_tiles[slot].offsets.empty())
+        {
+            ++slot;
+            continue;
+        }
+
+        m_tileSlots.erase(m_tiles[slot].index);
+        if(slot + 1 < m_tiles.size())
+        {
+            m_tiles[slot] = std::move(m_tiles.back());
+            m_tileWeights[slot] = m_tileWeights.back();
+            m_tileSlots[m_tiles[slot].index] = slot;
+        }
+        m_tiles.pop_back();
+        m_tileWeights.pop_back();
+        m_isDirty.pop_back();
+    }
+
+    return m_top.build(m_tileWeights.data(), m_tileWeights.size());
+}
+
+/**
+ * @brief Probability of a cell reconstructed from the tables
+ * @param x, y, z Cell coordinates
+ */
+double navis::util::GridDensitySampler::getProbability(std::size_t x, std::size_t y, std::size_t z) const
+{
+    assert(!isDirty());
+
+    std::size_t offset;
+    auto slot = m_tileSlots.find(locate(x, y, z, offset));
+    if(slot == m_tileSlots.end() || m_top.size() == 0)
+    {
+        return 0.0;
+    }
+
+    const Tile &tile = m_tiles[slot->second];
+    auto position = std::lower_bound(tile.offsets.begin(), tile.offsets.end(), offset);
+    if(position == tile.offsets.end() || *position != offset)
+    {
+        return 0.0;
+    }
+    return m_top.getProbability(slot->second) * tile.table.getProbability(position - tile.offsets.begin());
+}
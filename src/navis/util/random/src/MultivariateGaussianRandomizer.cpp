@@ -0,0 +1,27 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    MultivariateGaussianRandomizer.cpp
+ * @brief   Multivariate Gaussian Randomizer Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/MultivariateGaussianRandomizer.h"
+
+/**
+ * @brief Explicit instantiation of the supported engines
+ *        Member definitions live in the header so that they inline into the caller
+ */
+template class navis::util::BasicMultivariateGaussianRandomizer<std::mt19937>;
+template class navis::util::BasicMultivariateGaussianRandomizer<std::mt19937_64>;
+template class navis::util::BasicMultivariateGaussianRandomizer<navis::engine::Xoshiro256Engine>;
+template class navis::util::BasicMultivariateGaussianRandomizer<navis::engine::Pcg64Engine>;
+template class navis::util::BasicMultivariateGaussianRandomizer<navis::engine::PhiloxEngine>;
+template class navis::util::BasicMultivariateGaussianRandomizer<navis::engine::PrefetchingEngine>;
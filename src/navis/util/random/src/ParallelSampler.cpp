@@ -0,0 +1,164 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    ParallelSampler.cpp
+ * @brief   Parallel Monte Carlo Sampler Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/ParallelSampler.h"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+    /**
+     * @brief Chunk range of one worker, [begin, end) packed as (end << 32) | begin
+     */
+    struct alignas(64) ChunkRange
+    {
+        std::atomic<std::uint64_t> packed {0};
+    };
+
+    /**
+     * @brief Range packing functions
+     */
+    inline std::uint64_t pack(std::uint64_t begin, std::uint64_t end)
+    {
+        return (end << 32) | begin;
+    }
+
+    inline std::uint64_t rangeBegin(std::uint64_t packed)
+    {
+        return packed & 0xFFFFFFFFU;
+    }
+
+    inline std::uint64_t rangeEnd(std::uint64_t packed)
+    {
+        return packed >> 32;
+    }
+
+    /**
+     * @brief Steal the back half of the largest remaining range into the thief's empty range
+     * @param ranges Worker ranges
+     * @param threadCount Number of workers
+     * @param thief Index of the stealing worker
+     * @return False when no chunk is left anywhere
+     */
+    bool steal(ChunkRange *ranges, std::size_t threadCount, std::size_t thief)
+    {
+        while(true)
+        {
+            std::size_t victim = threadCount;
+            std::uint64_t victimRange = 0;
+            std::uint64_t largest = 0;
+
+            for(std::size_t worker = 0; worker < threadCount; ++worker)
+            {
+                std::uint64_t packed = ranges[worker].packed.load(std::memory_order_acquire);
+                std::uint64_t remaining = rangeEnd(packed) - rangeBegin(packed);
+                if(worker != thief && remaining > largest)
+                {
+                    victim      = worker;
+                    victimRange = packed;
+                    largest     = remaining;
+                }
+            }
+
+            if(victim == threadCount)
+            {
+                return false;
+            }
+
+            // The packed word is the whole range state, a successful exchange always splits the current range
+            const std::uint64_t end   = rangeEnd(victimRange);
+            const std::uint64_t split = end - (largest + 1) / 2;
+            if(ranges[victim].packed.compare_exchange_strong(victimRange, pack(rangeBegin(victimRange), split), std::memory_order_acq_rel))
+            {
+                ranges[thief].packed.store(pack(split, end), std::memory_order_release);
+                return true;
+            }
+        }
+    }
+
+} // namespace
+
+/**
+ * @brief Execute every chunk exactly once, returns when all chunks are done
+ * @param chunkCount Number of chunks
+ * @param threadCount Number of workers, the calling thread is worker 0
+ * @param task Chunk task, must not throw
+ * @return Number of steals
+ */
+std::uint64_t navis::util::WorkStealingScheduler::execute(std::size_t chunkCount, std::size_t threadCount, const Task &task)
+{
+    assert(chunkCount <= MAX_CHUNK_COUNT);
+    if(chunkCount == 0)
+    {
+        return 0;
+    }
+    threadCount = (threadCount == 0) ? 1 : ((threadCount > chunkCount) ? chunkCount : threadCount);
+
+    // Contiguous initial split, stealing only rebalances what is left
+    std::unique_ptr<ChunkRange[]> ranges(new ChunkRange[threadCount]);
+    for(std::size_t worker = 0; worker < threadCount; ++worker)
+    {
+        ranges[worker].packed.store(pack(worker * chunkCount / threadCount, (worker + 1) * chunkCount / threadCount), std::memory_order_relaxed);
+    }
+
+    std::atomic<std::uint64_t> stealCount {0};
+    auto work = [&](std::size_t worker)
+    {
+        ChunkRange &range = ranges[worker];
+        while(true)
+        {
+            // Take chunks from the front of the own range, thieves shrink it from the back
+            std::uint64_t packed = range.packed.load(std::memory_order_acquire);
+            while(rangeBegin(packed) < rangeEnd(packed))
+            {
+                if(range.packed.compare_exchange_weak(packed, packed + 1, std::memory_order_acq_rel))
+                {
+                    task(worker, static_cast<std::size_t>(rangeBegin(packed)));
+                    packed = range.packed.load(std::memory_order_acquire);
+                }
+            }
+
+            if(!steal(ranges.get(), threadCount, worker))
+            {
+                break;
+            }
+            stealCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for(std::size_t worker = 1; worker < threadCount; ++worker)
+    {
+        threads.emplace_back(work, worker);
+    }
+    work(0);
+
+    for(std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    return stealCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Default number of workers (hardware concurrency, at least 1)
+ */
+std::size_t navis::util::WorkStealingScheduler::getDefaultThreadCount()
+{
+    const unsigned int concurrency = std::thread::hardware_concurrency();
+    return (concurrency == 0) ? 1 : concurrency;
+}
@@ -0,0 +1,474 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    QuasiRandomizer.cpp
+ * @brief   Quasi Randomizer Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis/util/random/QuasiRandomizer.h"
+#include "navis/util/random/engine/EngineTraits.h"
+
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+namespace
+{
+    /**
+     * @brief Primitive polynomial and initial direction numbers of one Sobol dimension
+     *        (new-joe-kuo-6.21201, S. Joe and F. Y. Kuo, 2008)
+     */
+    struct SobolPolynomial
+    {
+        std::uint32_t degree;
+        std::uint32_t coefficients;
+        std::uint32_t initial[8];
+    };
+
+    /**
+     * @brief Sobol parameters of dimensions 2 to MAX_SOBOL_DIMENSION, the first dimension is the van der Corput sequence
+     */
+    constexpr SobolPolynomial SOBOL_POLYNOMIALS[] =
+    {
+        {1,  0, {1}},
+        {2,  1, {1, 3}},
+        {3,  1, {1, 3, 1}},
+        {3,  2, {1, 1, 1}},
+        {4,  1, {1, 1, 3, 3}},
+        {4,  4, {1, 3, 5, 13}},
+        {5,  2, {1, 1, 5, 5, 17}},
+        {5,  4, {1, 1, 5, 5, 5}},
+        {5,  7, {1, 1, 7, 11, 19}},
+        {5, 11, {1, 1, 5, 1, 1}},
+        {5, 13, {1, 1, 1, 3, 11}},
+        {5, 14, {1, 3, 5, 5, 31}},
+        {6,  1, {1, 3, 3, 9, 7, 49}},
+        {6, 13, {1, 1, 1, 15, 21, 21}},
+        {6, 16, {1, 3, 1, 13, 27, 49}},
+        {6, 19, {1, 1, 1, 15, 7, 5}},
+        {6, 22, {1, 3, 1, 15, 13, 25}},
+        {6, 25, {1, 1, 5, 5, 19, 61}},
+        {7,  1, {1, 3, 7, 11, 23, 15, 103}},
+        {7,  4, {1, 3, 7, 13, 13, 15, 69}},
+    };
+
+    static_assert(sizeof(SOBOL_POLYNOMIALS) / sizeof(SOBOL_POLYNOMIALS[0]) + 1 == navis::util::QuasiRandomizer::MAX_SOBOL_DIMENSION,
+                  "Sobol table size mismatch");
+
+    constexpr int SOBOL_BITS = 32;
+
+    /**
+     * @brief Conversion of a 32-bit fraction to [0, 1)
+     */
+    inline double fractionToDouble(std::uint32_t fraction)
+    {
+        return static_cast<double>(fraction) * 0x1.0p-32;
+    }
+
+    /**
+     * @brief Conversion of a 64-bit fraction to [0, 1)
+     */
+    inline double fractionToDouble(std::uint64_t fraction)
+    {
+        return static_cast<double>(fraction >> 11) * 0x1.0p-53;
+    }
+
+    /**
+     * @brief Scrambling word generator, counter-based so the tables do not depend on the construction order
+     */
+    class ScrambleWords
+    {
+        private:
+
+            std::uint64_t m_seed;
+            std::uint64_t m_counter {0};
+
+        public:
+
+            explicit ScrambleWords(std::uint64_t seed)
+              : m_seed(seed)
+            {
+            }
+
+            std::uint64_t operator()()
+            {
+                return navis::engine::splitMix64(m_seed + (++m_counter) * navis::engine::GOLDEN_GAMMA);
+            }
+    };
+
+} // namespace
+
+/**
+ * @brief Class constructor
+ * @param sequence Low-discrepancy sequence
+ * @param dimension Number of coordinates per point
+ */
+navis::util::QuasiRandomizer::QuasiRandomizer(Sequence sequence, std::size_t dimension)
+  : m_sequence(sequence)
+  , m_dimension(dimension)
+  , m_point(dimension)
+{
+    initialize(0);
+}
+
+/**
+ * @brief Class constructor
+ * @param sequence Low-discrepancy sequence
+ * @param dimension Number of coordinates per point
+ * @param scrambleSeed Randomized (scrambled) sequence with the specified seed
+ */
+navis::util::QuasiRandomizer::QuasiRandomizer(Sequence sequence, std::size_t dimension, std::uint_fast64_t scrambleSeed)
+  : m_sequence(sequence)
+  , m_dimension(dimension)
+  , m_point(dimension)
+{
+    // Seed 0 selects the unscrambled sequence internally
+    initialize((scrambleSeed == 0) ? 1 : scrambleSeed);
+}
+
+/**
+ * @brief Sequence tables initialization method
+ * @param scrambleSeed Scrambling seed, unscrambled when 0
+ */
+void navis::util::QuasiRandomizer::initialize(std::uint64_t scrambleSeed)
+{
+    ScrambleWords scramble(scrambleSeed);
+
+    switch(m_sequence)
+    {
+        case Sequence::HALTON:
+        {
+            // First primes by trial division
+            for(std::uint32_t candidate = 2; m_bases.size() < m_dimension; ++candidate)
+            {
+                bool isPrime = true;
+                for(std::uint32_t base : m_bases)
+                {
+                    if(base * base > candidate)
+                    {
+                        break;
+                    }
+                    if(candidate % base == 0)
+                    {
+                        isPrime = false;
+                        break;
+                    }
+                }
+                if(isPrime)
+                {
+                    m_bases.push_back(candidate);
+                }
+            }
+
+            // Digit permutations keep 0 fixed so that trailing zero digits contribute nothing
+            for(std::uint32_t base : m_bases)
+            {
+                m_offsets.push_back(static_cast<std::uint32_t>(m_permutations.size()));
+                std::size_t first = m_permutations.size();
+                for(std::uint32_t digit = 0; digit < base; ++digit)
+                {
+                    m_permutations.push_back(digit);
+                }
+
+                if(scrambleSeed != 0)
+                {
+                    for(std::uint32_t digit = base - 1; digit > 1; --digit)
+                    {
+                        std::uint32_t other = 1 + static_cast<std::uint32_t>(scramble() % digit);
+                        std::swap(m_permutations[first + digit], m_permutations[first + other]);
+                    }
+                }
+            }
+            break;
+        }
+
+        case Sequence::SOBOL:
+        {
+            assert(m_dimension <= MAX_SOBOL_DIMENSION);
+            m_directions.assign(SOBOL_BITS * m_dimension, 0);
+            m_digitalShifts.assign(m_dimension, 0);
+
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                std::uint32_t *directions = m_directions.data() + SOBOL_BITS * dimension;
+                if(dimension == 0)
+                {
+                    for(int bit = 0; bit < SOBOL_BITS; ++bit)
+                    {
+                        directions[bit] = 1u << (SOBOL_BITS - 1 - bit);
+                    }
+                }
+                else
+                {
+                    const SobolPolynomial &polynomial = SOBOL_POLYNOMIALS[dimension - 1];
+                    const int degree = static_cast<int>(polynomial.degree);
+
+                    for(int bit = 0; bit < degree; ++bit)
+                    {
+                        directions[bit] = polynomial.initial[bit] << (SOBOL_BITS - 1 - bit);
+                    }
+                    for(int bit = degree; bit < SOBOL_BITS; ++bit)
+                    {
+                        std::uint32_t value = directions[bit - degree] ^ (directions[bit - degree] >> degree);
+                        for(int term = 1; term < degree; ++term)
+                        {
+                            if((polynomial.coefficients >> (degree - 1 - term)) & 1u)
+                            {
+                                value ^= directions[bit - term];
+                            }
+                        }
+                        directions[bit] = value;
+                    }
+                }
+
+                if(scrambleSeed != 0)
+                {
+                    m_digitalShifts[dimension] = static_cast<std::uint32_t>(scramble() >> 32);
+                }
+            }
+            break;
+        }
+
+        case Sequence::R2:
+        {
+            // phi_d is the positive root of x^(d + 1) = x + 1, the increments are its inverse powers
+            double phi = 2.0;
+            for(int iteration = 0; iteration < 64; ++iteration)
+            {
+                double power = std::pow(phi, static_cast<double>(m_dimension));
+                phi -= (power * phi - phi - 1.0) / (static_cast<double>(m_dimension + 1) * power - 1.0);
+            }
+
+            long double increment = 1.0L;
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                increment /= static_cast<long double>(phi);
+                long double fraction = increment - std::floor(increment);
+                m_increments.push_back(static_cast<std::uint64_t>(std::ldexp(fraction, 64)));
+                m_shifts.push_back((scrambleSeed != 0) ? scramble() : (std::uint64_t{1} << 63));
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Move to the first coordinate of the specified point, O(1)
+ * @param index Point index
+ */
+void navis::util::QuasiRandomizer::skipTo(std::uint64_t index)
+{
+    m_index = index;
+    m_coordinate = 0;
+}
+
+/**
+ * @brief Random access point generation method, does not move the sequence
+ * @param index Point index
+ * @param output Output point (dimension elements)
+ */
+void navis::util::QuasiRandomizer::getPoint(std::uint64_t index, double *output) const
+{
+    switch(m_sequence)
+    {
+        case Sequence::HALTON:
+        {
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                const std::uint32_t base = m_bases[dimension];
+                const std::uint32_t *permutation = m_permutations.data() + m_offsets[dimension];
+                const double inverseBase = 1.0 / static_cast<double>(base);
+
+                double value = 0.0, factor = inverseBase;
+                for(std::uint64_t remain = index; remain != 0; remain /= base)
+                {
+                    value += permutation[remain % base] * factor;
+                    factor *= inverseBase;
+                }
+                output[dimension] = value;
+            }
+            break;
+        }
+
+        case Sequence::SOBOL:
+        {
+            assert(index <= 0xFFFFFFFFULL);
+            const std::uint32_t gray = static_cast<std::uint32_t>(index ^ (index >> 1));
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                const std::uint32_t *directions = m_directions.data() + SOBOL_BITS * dimension;
+                std::uint32_t value = m_digitalShifts[dimension];
+                for(std::uint32_t bits = gray; bits != 0; bits &= bits - 1)
+                {
+                    value ^= directions[__builtin_ctz(bits)];
+                }
+                output[dimension] = fractionToDouble(value);
+            }
+            break;
+        }
+
+        case Sequence::R2:
+        {
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                output[dimension] = fractionToDouble(m_shifts[dimension] + index * m_increments[dimension]);
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * @brief Next point generation method, starts a new point when a previous one is partially consumed
+ * @param output Output point (dimension elements)
+ */
+void navis::util::QuasiRandomizer::nextPoint(double *output)
+{
+    if(m_coordinate != 0)
+    {
+        skipTo(m_index + 1);
+    }
+    getPoint(m_index++, output);
+}
+
+/**
+ * @brief Fill the buffer with consecutive points in structure-of-arrays layout
+ *        Coordinate d of point i is written to buffer[d * size + i]
+ * @param buffer Caller-provided output buffer (dimension * size elements)
+ * @param size Number of points to generate
+ */
+void navis::util::QuasiRandomizer::fillPoints(double *buffer, std::size_t size)
+{
+    if(m_coordinate != 0)
+    {
+        skipTo(m_index + 1);
+    }
+    if(size == 0)
+    {
+        return;
+    }
+
+    const std::uint64_t first = m_index;
+    switch(m_sequence)
+    {
+        case Sequence::HALTON:
+        {
+            for(std::size_t index = 0; index < size; ++index)
+            {
+                getPoint(first + index, m_point.data());
+                for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+                {
+                    buffer[dimension * size + index] = m_point[dimension];
+                }
+            }
+            break;
+        }
+
+        case Sequence::SOBOL:
+        {
+            // Gray code order : consecutive points differ by one direction number
+            assert(first + size - 1 <= 0xFFFFFFFFULL);
+            const std::uint32_t gray = static_cast<std::uint32_t>(first ^ (first >> 1));
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                const std::uint32_t *directions = m_directions.data() + SOBOL_BITS * dimension;
+                double *output = buffer + dimension * size;
+
+                std::uint32_t value = m_digitalShifts[dimension];
+                for(std::uint32_t bits = gray; bits != 0; bits &= bits - 1)
+                {
+                    value ^= directions[__builtin_ctz(bits)];
+                }
+
+                output[0] = fractionToDouble(value);
+                for(std::size_t index = 1; index < size; ++index)
+                {
+                    value ^= directions[__builtin_ctzll(first + index)];
+                    output[index] = fractionToDouble(value);
+                }
+            }
+            break;
+        }
+
+        case Sequence::R2:
+        {
+            for(std::size_t dimension = 0; dimension < m_dimension; ++dimension)
+            {
+                const std::uint64_t increment = m_increments[dimension];
+                double *output = buffer + dimension * size;
+
+                std::uint64_t value = m_shifts[dimension] + first * increment;
+                for(std::size_t index = 0; index < size; ++index)
+                {
+                    output[index] = fractionToDouble(value);
+                    value += increment;
+                }
+            }
+            break;
+        }
+    }
+    m_index = first + size;
+}
+
+/**
+ * @brief Next coordinate of the current point mapped to the range
+ * @param lowerBound Lower boundary of the result (default : 0.0)
+ * @param upperBound Upper boundary of the result (default : 1.0)
+ */
+double navis::util::QuasiRandomizer::uniformDouble(double lowerBound, double upperBound)
+{
+    assert(lowerBound < upperBound);
+    if(m_coordinate == 0)
+    {
+        getPoint(m_index, m_point.data());
+    }
+
+    double value = m_point[m_coordinate];
+    if(++m_coordinate == m_dimension)
+    {
+        skipTo(m_index + 1);
+    }
+    return (upperBound - lowerBound) * value + lowerBound;
+}
+
+/**
+ * @brief Next coordinate of the current point mapped to the integer range
+ * @param lowerBound Lower boundary of the result
+ * @param upperBound Upper boundary of the result
+ */
+int navis::util::QuasiRandomizer::uniformInt(int lowerBound, int upperBound)
+{
+    auto result = (int)std::floor(uniformDouble((double)lowerBound, (double)(upperBound) + 1.0));
+    return (result > upperBound) ? upperBound : result;
+}
+
+/**
+ * @brief Next coordinate of the current point mapped to a boolean
+ */
+bool navis::util::QuasiRandomizer::uniformBool()
+{
+    return uniformDouble() < 0.5;
+}
+
+/**
+ * @brief Fill the buffer with consecutive coordinates mapped to the range
+ * @param buffer Caller-provided output buffer
+ * @param size Number of values to generate
+ * @param lowerBound Lower boundary of the result (default : 0.0)
+ * @param upperBound Upper boundary of the result (default : 1.0)
+ */
+void navis::util::QuasiRandomizer::fillUniformDouble(double *buffer, std::size_t size, double lowerBound, double upperBound)
+{
+    for(std::size_t index = 0; index < size; ++index)
+    {
+        buffer[index] = uniformDouble(lowerBound, upperBound);
+    }
+}
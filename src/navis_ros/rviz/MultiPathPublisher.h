@@ -1 +1,241 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    MultiPathPublisher.h
+ * @brief   Multiple Path Visualization Publisher Class Definition
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
 
+#ifndef NAVIS_ROS_RVIZ_MULTIPATHPUBLISHER_H_
+#define NAVIS_ROS_RVIZ_MULTIPATHPUBLISHER_H_
+
+#include "navis/util/math/Pose.h"
+
+#include <rclcpp/rclcpp.hpp>
+#include <std_msgs/msg/color_rgba.hpp>
+#include <visualization_msgs/msg/marker.hpp>
+#include <visualization_msgs/msg/marker_array.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace navis
+{
+    namespace ros
+    {
+        /**
+         * @brief   navis::ros::MultiPathPublisher
+         * @details rviz publisher for hundreds of candidate paths per planning cycle
+         *          Paths live in fixed slots, and every pathsPerMarker slots share one LINE_LIST marker with per-vertex colors.
+         *          Each path is decimated to pointBudget / maxPaths points when it is set. Only markers whose paths changed
+         *          are sent, and the change test compares a hash of the decimated points and color.
+         *          The marker buffers are allocated once and reused, and publishing runs at its own rate on a wall timer,
+         *          decoupled from the planning loop that calls setPath(). The message is built under the path lock and sent
+         *          after releasing it, so setPath() never waits for the middleware.
+         *          Intra-process delivery gives no allocation benefit : rclcpp copies a const reference message into an owned
+         *          one for intra-process subscribers, and handing it an owned copy would allocate just the same.
+         *          setPath() and publish() may be called from different threads.
+         */
+        class MultiPathPublisher
+        {
+            // "MultiPathPublisher" members
+            public:
+
+                /**
+                 * @brief Publisher options
+                 */
+                struct Options
+                {
+                    std::string frameId {"map"};
+                    std::string markerNamespace {"paths"};
+
+                    /**
+                     * @brief Maximum number of paths and total number of points kept for them
+                     */
+                    std::size_t maxPaths {1024};
+                    std::size_t pointBudget {200000};
+
+                    /**
+                     * @brief Number of paths merged into one LINE_LIST marker, the unit of delta updates
+                     */
+                    std::size_t pathsPerMarker {32};
+
+                    double lineWidth {0.02};
+
+                    /**
+                     * @brief Maximum publish rate [Hz] (0 : unlimited), a wall timer publishes at this rate when isTimerDriven
+                     */
+                    double maxRate {10.0};
+                    bool isTimerDriven {true};
+
+                    std::size_t queueDepth {1};
+                };
+
+                /**
+                 * @brief Publish counters
+                 */
+                struct Statistics
+                {
+                    std::uint64_t publishCount {0};
+                    std::uint64_t markerCount {0};
+                    std::uint64_t pointCount {0};
+                    double lastLatency {0.0};
+                };
+
+            private:
+
+                /**
+                 * @brief Stored path, vertices are line list segment pairs
+                 */
+                struct Slot
+                {
+                    bool isUsed {false};
+                    std::uint32_t id {0};
+                    std::uint64_t hash {0};
+                    std_msgs::msg::ColorRGBA color;
+                    std::vector<geometry_msgs::msg::Point> vertices;
+                };
+
+                Options m_options;
+                std::size_t m_pathPoints;
+                rclcpp::Clock::SharedPtr m_clock;
+                rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr m_publisher;
+                rclcpp::TimerBase::SharedPtr m_timer;
+
+                std::vector<Slot> m_slots;
+                std::unordered_map<std::uint32_t, std::size_t> m_slotIndices;
+                std::vector<std::size_t> m_freeSlots;
+
+                /**
+                 * @brief Marker of each slot group and the outgoing array, swapped in and out around a publish
+                 */
+                std::vector<visualization_msgs::msg::Marker> m_markers;
+                std::vector<std::size_t> m_dirtyMarkers;
+                std::vector<bool> m_isDirty;
+
+                /**
+                 * @brief Outgoing array and the indices of its markers, owned by the publish in progress
+                 */
+                visualization_msgs::msg::MarkerArray m_message;
+                std::vector<std::size_t> m_sentMarkers;
+
+                std::chrono::steady_clock::time_point m_lastPublish;
+                Statistics m_statistics;
+
+                /**
+                 * @brief m_mutex guards the paths, the markers and the counters, m_publishMutex serializes the publishes
+                 */
+                mutable std::mutex m_mutex;
+                std::mutex m_publishMutex;
+
+            // "MultiPathPublisher" methods
+            private:
+
+                /**
+                 * @brief Decimate a path into the line list vertices of a slot
+                 * @param slot Path slot
+                 * @param x, y, z Path components (z : nullptr for a planar path)
+                 * @param size Number of path points
+                 * @return Hash of the kept points
+                 */
+                std::uint64_t storeVertices(Slot &slot, const double *x, const double *y, const double *z, std::size_t size) const;
+
+                /**
+                 * @brief Mark the marker of a slot for the next publish()
+                 * @param slot Slot index
+                 */
+                void markDirty(std::size_t slot);
+
+                /**
+                 * @brief Rewrite a marker from the paths of its slots
+                 * @param marker Output marker
+                 * @param index Marker index
+                 * @param stamp Header time stamp
+                 */
+                void fillMarker(visualization_msgs::msg::Marker &marker, std::size_t index, const rclcpp::Time &stamp) const;
+
+                /**
+                 * @brief Send the changed markers, the middleware is called without holding the path lock
+                 * @param isRateLimited Whether maxRate holds the update back, false for the timer that already sets the pace
+                 * @return False when nothing changed or the rate limit holds the update back
+                 */
+                bool publishChanges(bool isRateLimited);
+
+            public:
+
+                /**
+                 * @brief Class constructor
+                 * @param node Node owning the publisher and the publish timer
+                 * @param topic MarkerArray topic name
+                 * @param options Publisher options (default : Options())
+                 */
+                MultiPathPublisher(rclcpp::Node &node, const std::string &topic);
+                MultiPathPublisher(rclcpp::Node &node, const std::string &topic, const Options &options);
+
+                /**
+                 * @brief Add or replace a path, sent on the next publish() only when the decimated path or color changed
+                 * @param id Path identifier
+                 * @param x, y, z Path components (z : nullptr for a planar path)
+                 * @param size Number of path points
+                 * @param color Line color
+                 * @return False when maxPaths paths are already stored
+                 */
+                bool setPath(std::uint32_t id, const double *x, const double *y, const double *z, std::size_t size, const std_msgs::msg::ColorRGBA &color);
+                bool setPath(std::uint32_t id, const navis::util::Pose2DArray &path, const std_msgs::msg::ColorRGBA &color);
+                bool setPath(std::uint32_t id, const navis::util::Pose3DArray &path, const std_msgs::msg::ColorRGBA &color);
+
+                /**
+                 * @brief Remove a path
+                 * @param id Path identifier
+                 * @return False when the path is unknown
+                 */
+                bool removePath(std::uint32_t id);
+
+                /**
+                 * @brief Remove every path
+                 */
+                void clear();
+
+                /**
+                 * @brief Send the changed markers, the timer sends them on its own schedule when isTimerDriven
+                 * @return False when nothing changed or the last publish is less than 1 / maxRate ago
+                 */
+                bool publish();
+
+                /**
+                 * @brief Number of stored paths getter method
+                 */
+                std::size_t getPathCount() const;
+
+                /**
+                 * @brief Points kept per path getter method
+                 */
+                std::size_t getPathPoints() const
+                {
+                    return m_pathPoints;
+                }
+
+                /**
+                 * @brief Publish counters getter method
+                 */
+                Statistics getStatistics() const;
+
+        }; // class MultiPathPublisher
+
+    } // namespace ros
+
+} // namespace navis
+
+#endif // NAVIS_ROS_RVIZ_MULTIPATHPUBLISHER_H_
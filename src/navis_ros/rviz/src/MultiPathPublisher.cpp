@@ -0,0 +1,388 @@
+/**
+ * --------------------------------------------------
+ *
+ * @file    MultiPathPublisher.cpp
+ * @brief   Multiple Path Visualization Publisher Class Source
+ * @author  Minkyu Kil
+ * @date    2025-01-01
+ * @version 1.0
+ *
+ * Copyright (c) 2025, Minkyu Kil
+ * All rights reserved
+ *
+ * --------------------------------------------------
+ */
+
+#include "navis_ros/rviz/MultiPathPublisher.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+    /**
+     * @brief Chain a 64-bit word onto a hash, multiply-xorshift mixing
+     * @param hash Previous hash
+     * @param word Word to add
+     */
+    inline std::uint64_t hashWord(std::uint64_t hash, std::uint64_t word)
+    {
+        hash = (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+        return hash ^ (hash >> 29);
+    }
+
+    /**
+     * @brief Bit pattern of a double
+     */
+    inline std::uint64_t toBits(double value)
+    {
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+} // namespace
+
+/**
+ * @brief Class constructor
+ * @param node Node owning the publisher and the publish timer
+ * @param topic MarkerArray topic name
+ */
+navis::ros::MultiPathPublisher::MultiPathPublisher(rclcpp::Node &node, const std::string &topic)
+  : MultiPathPublisher(node, topic, Options())
+{
+}
+
+/**
+ * @brief Class constructor
+ * @param node Node owning the publisher and the publish timer
+ * @param topic MarkerArray topic name
+ * @param options Publisher options
+ */
+navis::ros::MultiPathPublisher::MultiPathPublisher(rclcpp::Node &node, const std::string &topic, const Options &options)
+  : m_options(options)
+  , m_pathPoints(std::max<std::size_t>(2, options.pointBudget / std::max<std::size_t>(1, options.maxPaths)))
+  , m_clock(node.get_clock())
+  , m_slots(options.maxPaths)
+  , m_markers((options.maxPaths + options.pathsPerMarker - 1) / options.pathsPerMarker)
+  , m_isDirty(m_markers.size(), false)
+{
+    assert(options.maxPaths > 0 && options.pathsPerMarker > 0);
+
+    // Buffers sized for full markers up front, the publish path only clears and refills them
+    const std::size_t segmentVertices = 2 * (m_pathPoints - 1);
+    for(std::size_t slot = 0; slot < m_slots.size(); ++slot)
+    {
+        m_slots[slot].vertices.reserve(segmentVertices);
+        m_freeSlots.push_back(m_slots.size() - 1 - slot);
+    }
+    for(auto &marker : m_markers)
+    {
+        marker.points.reserve(options.pathsPerMarker * segmentVertices);
+        marker.colors.reserve(options.pathsPerMarker * segmentVertices);
+    }
+    m_message.markers.reserve(m_markers.size());
+    m_dirtyMarkers.reserve(m_markers.size());
+    m_sentMarkers.reserve(m_markers.size());
+    m_slotIndices.reserve(options.maxPaths);
+
+    m_publisher = node.create_publisher<visualization_msgs::msg::MarkerArray>(topic, rclcpp::QoS(options.queueDepth));
+
+    if(options.isTimerDriven && options.maxRate > 0.0)
+    {
+        // The timer keeps a fixed schedule, a late tick must not make the next one look early to the rate check
+        m_timer = node.create_wall_timer(std::chrono::duration<double>(1.0 / options.maxRate), [this]()
+        {
+            publishChanges(false);
+        });
+    }
+}
+
+/**
+ * @brief Decimate a path into the line list vertices of a slot
+ *        Keeps both end points and evenly spaced points in between
+ * @param slot Path slot
+ * @param x, y, z Path components (z : nullptr for a planar path)
+ * @param size Number of path points
+ * @return Hash of the kept points
+ */
+std::uint64_t navis::ros::MultiPathPublisher::storeVertices(Slot &slot, const double *x, const double *y, const double *z, std::size_t size) const
+{
+    std::uint64_t hash = size;
+    slot.vertices.clear();
+    if(size < 2)
+    {
+        return hash;
+    }
+
+    const std::size_t count = std::min(size, m_pathPoints);
+    const double stride = static_cast<double>(size - 1) / static_cast<double>(count - 1);
+
+    geometry_msgs::msg::Point previous;
+    for(std::size_t point = 0; point < count; ++point)
+    {
+        const std::size_t index = (point + 1 == count) ? size - 1 : static_cast<std::size_t>(static_cast<double>(point) * stride + 0.5);
+
+        geometry_msgs::msg::Point vertex;
+        vertex.x = x[index];
+        vertex.y = y[index];
+        vertex.z = (z != nullptr) ? z[index] : 0.0;
+        hash = hashWord(hashWord(hashWord(hash, toBits(vertex.x)), toBits(vertex.y)), toBits(vertex.z));
+
+        if(point > 0)
+        {
+            slot.vertices.push_back(previous);
+            slot.vertices.push_back(vertex);
+        }
+        previous = vertex;
+    }
+    return hash;
+}
+
+/**
+ * @brief Mark the marker of a slot for the next publish()
+ * @param slot Slot index
+ */
+void navis::ros::MultiPathPublisher::markDirty(std::size_t slot)
+{
+    const std::size_t marker = slot / m_options.pathsPerMarker;
+    if(!m_isDirty[marker])
+    {
+        m_isDirty[marker] = true;
+        m_dirtyMarkers.push_back(marker);
+    }
+}
+
+/**
+ * @brief Rewrite a marker from the paths of its slots
+ * @param marker Output marker
+ * @param index Marker index
+ * @param stamp Header time stamp
+ */
+void navis::ros::MultiPathPublisher::fillMarker(visualization_msgs::msg::Marker &marker, std::size_t index, const rclcpp::Time &stamp) const
+{
+    marker.header.frame_id = m_options.frameId;
+    marker.header.stamp = stamp;
+    marker.ns = m_options.markerNamespace;
+    marker.id = static_cast<std::int32_t>(index);
+    marker.type = visualization_msgs::msg::Marker::LINE_LIST;
+    marker.pose.orientation.w = 1.0;
+    marker.scale.x = m_options.lineWidth;
+    marker.color.a = 1.0f;
+    marker.points.clear();
+    marker.colors.clear();
+
+    const std::size_t first = index * m_options.pathsPerMarker;
+    const std::size_t last  = std::min(first + m_options.pathsPerMarker, m_slots.size());
+    for(std::size_t slot = first; slot < last; ++slot)
+    {
+        if(m_slots[slot].isUsed)
+        {
+            marker.points.insert(marker.points.end(), m_slots[slot].vertices.begin(), m_slots[slot].vertices.end());
+            marker.colors.insert(marker.colors.end(), m_slots[slot].vertices.size(), m_slots[slot].color);
+        }
+    }
+
+    marker.action = marker.points.empty() ? visualization_msgs::msg::Marker::DELETE : visualization_msgs::msg::Marker::ADD;
+}
+
+/**
+ * @brief Send the changed markers, the middleware is called without holding the path lock
+ * @param isRateLimited Whether maxRate holds the update back, false for the timer that already sets the pace
+ * @return False when nothing changed or the rate limit holds the update back
+ */
+bool navis::ros::MultiPathPublisher::publishChanges(bool isRateLimited)
+{
+    std::lock_guard<std::mutex> publishLock(m_publishMutex);
+    const auto start = std::chrono::steady_clock::now();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if(m_dirtyMarkers.empty())
+        {
+            return false;
+        }
+        if(isRateLimited && m_options.maxRate > 0.0 && m_statistics.publishCount > 0 &&
+           std::chrono::duration<double>(start - m_lastPublish).count() < 1.0 / m_options.maxRate)
+        {
+            return false;
+        }
+
+        // Swap the preallocated markers into the outgoing array instead of copying them, later changes mark them dirty again
+        const rclcpp::Time stamp = m_clock->now();
+        std::swap(m_sentMarkers, m_dirtyMarkers);
+        m_dirtyMarkers.clear();
+        m_message.markers.resize(m_sentMarkers.size());
+        for(std::size_t index = 0; index < m_sentMarkers.size(); ++index)
+        {
+            std::swap(m_message.markers[index], m_markers[m_sentMarkers[index]]);
+            fillMarker(m_message.markers[index], m_sentMarkers[index], stamp);
+            m_isDirty[m_sentMarkers[index]] = false;
+            m_statistics.pointCount += m_message.markers[index].points.size();
+        }
+        m_lastPublish = start;
+    }
+
+    m_publisher->publish(m_message);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(std::size_t index = 0; index < m_sentMarkers.size(); ++index)
+    {
+        std::swap(m_message.markers[index], m_markers[m_sentMarkers[index]]);
+    }
+
+    m_statistics.markerCount += m_sentMarkers.size();
+    m_sentMarkers.clear();
+    m_message.markers.clear();
+
+    ++m_statistics.publishCount;
+    m_statistics.lastLatency = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return true;
+}
+
+/**
+ * @brief Add or replace a path, sent on the next publish() only when the decimated path or color changed
+ * @param id Path identifier
+ * @param x, y, z Path components (z : nullptr for a planar path)
+ * @param size Number of path points
+ * @param color Line color
+ * @return False when maxPaths paths are already stored
+ */
+bool navis::ros::MultiPathPublisher::setPath(std::uint32_t id, const double *x, const double *y, const double *z, std::size_t size,
+                                             const std_msgs::msg::ColorRGBA &color)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto found = m_slotIndices.find(id);
+    if(found == m_slotIndices.end())
+    {
+        if(m_freeSlots.empty())
+        {
+            return false;
+        }
+
+        found = m_slotIndices.emplace(id, m_freeSlots.back()).first;
+        m_freeSlots.pop_back();
+        m_slots[found->second].isUsed = true;
+        m_slots[found->second].id = id;
+        m_slots[found->second].hash = 0;
+    }
+
+    Slot &slot = m_slots[found->second];
+    std::uint64_t hash = storeVertices(slot, x, y, z, size);
+
+    std::uint32_t components[4];
+    std::memcpy(components, &color.r, sizeof(float));
+    std::memcpy(components + 1, &color.g, sizeof(float));
+    std::memcpy(components + 2, &color.b, sizeof(float));
+    std::memcpy(components + 3, &color.a, sizeof(float));
+    hash = hashWord(hashWord(hash, components[0] | (static_cast<std::uint64_t>(components[1]) << 32)),
+                    components[2] | (static_cast<std::uint64_t>(components[3]) << 32));
+
+    if(hash != slot.hash)
+    {
+        slot.hash = hash;
+        slot.color = color;
+        markDirty(found->second);
+    }
+    return true;
+}
+
+/**
+ * @brief Add or replace a planar path
+ * @param id Path identifier
+ * @param path Path poses, the headings are not drawn
+ * @param color Line color
+ * @return False when maxPaths paths are already stored
+ */
+bool navis::ros::MultiPathPublisher::setPath(std::uint32_t id, const navis::util::Pose2DArray &path, const std_msgs::msg::ColorRGBA &color)
+{
+    return setPath(id, path.x.data(), path.y.data(), nullptr, path.size(), color);
+}
+
+/**
+ * @brief Add or replace a spatial path
+ * @param id Path identifier
+ * @param path Path poses, the orientations are not drawn
+ * @param color Line color
+ * @return False when maxPaths paths are already stored
+ */
+bool navis::ros::MultiPathPublisher::setPath(std::uint32_t id, const navis::util::Pose3DArray &path, const std_msgs::msg::ColorRGBA &color)
+{
+    return setPath(id, path.x.data(), path.y.data(), path.z.data(), path.size(), color);
+}
+
+/**
+ * @brief Remove a path
+ * @param id Path identifier
+ * @return False when the path is unknown
+ */
+bool navis::ros::MultiPathPublisher::removePath(std::uint32_t id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto found = m_slotIndices.find(id);
+    if(found == m_slotIndices.end())
+    {
+        return false;
+    }
+
+    Slot &slot = m_slots[found->second];
+    slot.isUsed = false;
+    slot.vertices.clear();
+    markDirty(found->second);
+    m_freeSlots.push_back(found->second);
+    m_slotIndices.erase(found);
+    return true;
+}
+
+/**
+ * @brief Remove every path
+ */
+void navis::ros::MultiPathPublisher::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_freeSlots.clear();
+    for(std::size_t slot = m_slots.size(); slot-- > 0;)
+    {
+        if(m_slots[slot].isUsed)
+        {
+            m_slots[slot].isUsed = false;
+            m_slots[slot].vertices.clear();
+            markDirty(slot);
+        }
+        m_freeSlots.push_back(slot);
+    }
+    m_slotIndices.clear();
+}
+
+/**
+ * @brief Send the changed markers, the timer sends them on its own schedule when isTimerDriven
+ * @return False when nothing changed or the last publish is less than 1 / maxRate ago
+ */
+bool navis::ros::MultiPathPublisher::publish()
+{
+    return publishChanges(true);
+}
+
+/**
+ * @brief Number of stored paths getter method
+ */
+std::size_t navis::ros::MultiPathPublisher::getPathCount() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slotIndices.size();
+}
+
+/**
+ * @brief Publish counters getter method
+ */
+navis::ros::MultiPathPublisher::Statistics navis::ros::MultiPathPublisher::getStatistics() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_statistics;
+}